@@ -0,0 +1,50 @@
+/*
+ * backup.h
+ *
+ *  Public interface of the warm restart state.
+ *  The clock, the date, the last sensor values and the alert are kept in the
+ *  backup domain registers (BKP on F103, RTC backup registers on F072), which
+ *  survive a reset and, with a battery or a supercap on VBAT, a power cut.
+ *  After a reset main restores them and redraws the screen at once instead
+ *  of waiting for the sensor, the wifi and a full clear.
+ *
+ *  The state is saved by main when it changes and by the PVD interrupt when
+ *  the supply falls under BACKUP_PVD_LEVEL, the last chance before power is
+ *  lost.
+ */
+
+#ifndef BACKUP_INC_BACKUP_H_
+#define BACKUP_INC_BACKUP_H_
+
+#include <stdint.h>
+
+#define BACKUP_MAGIC 0xC10C
+
+/* Values needed to draw the screen again */
+typedef struct
+{
+	uint16_t minute;       // minutes since midnight, local time
+	uint8_t day;           // day of the week, 0 to 6
+	uint8_t dd;
+	uint8_t mm;            // 0 = january
+	uint16_t yy;           // 2000 to 2127
+	uint8_t moon_phase;
+	int16_t temp;          // 0.1 °C
+	uint16_t press;        // hPa
+	uint8_t hum;           // %
+	uint8_t temp_alert;
+	int16_t clock_trim;    // 0.1 ppm, RTC drift learned by the syncs
+	uint8_t zone;          // time zone + 1, 0 = not saved (state of an older firmware)
+} Backup_State;
+
+/* Fills the state with the current values, called from the PVD interrupt */
+typedef void (*Backup_Get_State)(Backup_State *state);
+
+void Backup_Init(void);
+int Backup_Load(Backup_State *state);
+void Backup_Save(const Backup_State *state);
+void Backup_Clear(void);
+void Backup_PVD_Init(Backup_Get_State get);
+void Backup_PVD_IRQHandler(void);
+
+#endif /* BACKUP_INC_BACKUP_H_ */
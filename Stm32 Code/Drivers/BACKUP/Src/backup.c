@@ -0,0 +1,174 @@
+/*
+ * backup.c
+ *
+ *  Description:
+ *  Warm restart state in the backup domain registers, see backup.h.
+ *
+ *  The state is packed in 8 words of 16 bits: one BKP data register each on
+ *  the F103 (DR1 to DR8), two per RTC backup register on the F072 (BKP0R to
+ *  BKP3R). The first word is BACKUP_MAGIC, the last a check of the others,
+ *  a backup domain that was never written or lost its power fails one of
+ *  them.
+ */
+
+#include "backup.h"
+#include "main.h"
+
+#define BACKUP_WORDS 8
+#define BACKUP_PVD_LEVEL PWR_CR_PLS_LEV7 // 2.9 V, the highest threshold under 3.3 V
+
+static Backup_Get_State backup_get = NULL;
+
+/**
+ * @brief  Check word of the state, seeded so that all zero words fail.
+ */
+static uint16_t Backup_Check(const uint16_t *words)
+{
+	uint16_t check = BACKUP_MAGIC;
+
+	for (uint8_t n = 0; n < BACKUP_WORDS - 1; n++)
+		check = (uint16_t)((check << 1) | (check >> 15)) ^ words[n];
+	return check;
+}
+
+static void Backup_Write(const uint16_t *words)
+{
+#if defined(STM32F1)
+	for (uint8_t n = 0; n < BACKUP_WORDS; n++)
+		(&BKP->DR1)[n] = words[n];
+#else
+	for (uint8_t n = 0; n < BACKUP_WORDS; n += 2)
+		(&RTC->BKP0R)[n / 2] = words[n] | ((uint32_t)words[n + 1] << 16);
+#endif
+}
+
+static void Backup_Read(uint16_t *words)
+{
+#if defined(STM32F1)
+	for (uint8_t n = 0; n < BACKUP_WORDS; n++)
+		words[n] = (uint16_t)(&BKP->DR1)[n];
+#else
+	for (uint8_t n = 0; n < BACKUP_WORDS; n += 2)
+	{
+		uint32_t reg = (&RTC->BKP0R)[n / 2];
+		words[n] = (uint16_t)reg;
+		words[n + 1] = (uint16_t)(reg >> 16);
+	}
+#endif
+}
+
+/**
+ * @brief  Clock the backup interface and allow writes to the backup domain,
+ *         call once at boot before the other functions.
+ */
+void Backup_Init(void)
+{
+#if defined(STM32F1)
+	RCC->APB1ENR |= RCC_APB1ENR_PWREN | RCC_APB1ENR_BKPEN;
+#else
+	RCC->APB1ENR |= RCC_APB1ENR_PWREN;
+#endif
+	(void)RCC->APB1ENR; // clock running before the first access
+	PWR->CR |= PWR_CR_DBP;
+}
+
+/**
+ * @brief  Read the state saved before the reset.
+ * @retval 0 on a warm restart, -1 if no valid state was saved (cold boot)
+ */
+int Backup_Load(Backup_State *state)
+{
+	uint16_t words[BACKUP_WORDS];
+
+	Backup_Read(words);
+	if (words[0] != BACKUP_MAGIC || words[BACKUP_WORDS - 1] != Backup_Check(words))
+		return -1;
+
+	state->minute = words[1] & 0x07FF;
+	state->day = (words[1] >> 11) & 0x07;
+	state->temp_alert = (words[1] >> 14) & 0x01;
+	state->dd = words[2] & 0x1F;
+	state->mm = (words[2] >> 5) & 0x0F;
+	state->yy = 2000 + (words[2] >> 9);
+	state->temp = (int16_t)words[3];
+	state->press = words[4];
+	state->hum = words[5] & 0xFF;
+	state->moon_phase = (words[5] >> 8) & 0x07;
+	state->zone = words[5] >> 11;
+	state->clock_trim = (int16_t)words[6];
+
+	if (state->minute >= 1440 || state->day >= 7 || state->dd == 0 || state->mm > 11)
+		return -1;
+	return 0;
+}
+
+/**
+ * @brief  Save the state, a few register writes: cheap enough to be called
+ *         every minute and from the PVD interrupt.
+ */
+void Backup_Save(const Backup_State *state)
+{
+	uint16_t words[BACKUP_WORDS];
+
+	words[0] = BACKUP_MAGIC;
+	words[1] = (state->minute & 0x07FF) | ((state->day & 0x07) << 11) | ((state->temp_alert & 0x01) << 14);
+	words[2] = (state->dd & 0x1F) | ((state->mm & 0x0F) << 5) | (((state->yy - 2000) & 0x7F) << 9);
+	words[3] = (uint16_t)state->temp;
+	words[4] = state->press;
+	words[5] = state->hum | ((state->moon_phase & 0x07) << 8) | ((state->zone & 0x1F) << 11);
+	words[6] = (uint16_t)state->clock_trim;
+	words[BACKUP_WORDS - 1] = Backup_Check(words);
+
+	Backup_Write(words);
+}
+
+/**
+ * @brief  Forget the saved state, the next reset is a cold boot.
+ */
+void Backup_Clear(void)
+{
+	uint16_t words[BACKUP_WORDS] = {0};
+
+	Backup_Write(words);
+}
+
+/**
+ * @brief  Save the state when the supply falls under BACKUP_PVD_LEVEL.
+ * @param  get: fills the state with the current values
+ *
+ * The PVD output goes through EXTI line 16, rising when the supply falls.
+ * Add Backup_PVD_IRQHandler to the PVD interrupt handler.
+ */
+void Backup_PVD_Init(Backup_Get_State get)
+{
+	backup_get = get;
+
+	PWR->CR = (PWR->CR & ~PWR_CR_PLS) | BACKUP_PVD_LEVEL | PWR_CR_PVDE;
+	EXTI->IMR |= EXTI_IMR_MR16;
+	EXTI->RTSR |= EXTI_RTSR_TR16;
+	EXTI->PR = EXTI_PR_PR16;
+
+#if defined(STM32F1)
+	NVIC_SetPriority(PVD_IRQn, 0);
+	NVIC_EnableIRQ(PVD_IRQn);
+#else
+	NVIC_SetPriority(PVD_VDDIO2_IRQn, 0);
+	NVIC_EnableIRQ(PVD_VDDIO2_IRQn);
+#endif
+}
+
+/**
+ * @brief  Supply falling: save the current state while the MCU still runs.
+ */
+void Backup_PVD_IRQHandler(void)
+{
+	EXTI->PR = EXTI_PR_PR16;
+
+	if (backup_get != NULL)
+	{
+		Backup_State state;
+
+		backup_get(&state);
+		Backup_Save(&state);
+	}
+}
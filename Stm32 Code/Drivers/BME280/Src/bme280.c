@@ -9,6 +9,8 @@
  */
 
 #include "bme280.h"
+#include "energy.h"
+#include "probe.h"
 #include "stdio.h"
 
 /* ========= Calibration coefficients from BME280 ========== */
@@ -70,7 +72,9 @@ static uint32_t BME_hum_comp(int adc_H);
 void I2C_Write_nByte(uint8_t *buffer, uint32_t len)
 {
 	uint16_t l_shift_addr = BME_ADDR<<1; // HAL expects 8-bit address
+	ENERGY_START(ENERGY_I2C);
 	HAL_I2C_Master_Transmit(bme_i2c, l_shift_addr, buffer, len, 1000);
+	ENERGY_STOP(ENERGY_I2C);
 	HAL_Delay(100);
 }
 
@@ -83,11 +87,15 @@ void I2C_Read_nByte(uint8_t addr, uint8_t *buffer, uint32_t len)
 	uint16_t l_shift_addr = BME_ADDR<<1; // HAL expects 8-bit address
 
 	/* Send register address */
+	ENERGY_START(ENERGY_I2C);
 	HAL_I2C_Master_Transmit(bme_i2c, l_shift_addr, &addr, 1, 1000);
+	ENERGY_STOP(ENERGY_I2C);
 	HAL_Delay(100);
 
 	/* Read data */
+	ENERGY_START(ENERGY_I2C);
 	HAL_I2C_Master_Receive(bme_i2c, l_shift_addr, buffer, len, 1000);
+	ENERGY_STOP(ENERGY_I2C);
 	HAL_Delay(100);
 }
 
@@ -133,6 +141,8 @@ void BME_Read_Data(int *temp, uint32_t *press, uint32_t *hum)
 	uint8_t cmd[2];
 	uint8_t reg_value;
 
+	PROBE_BEGIN(PROBE_BME_READ);
+
 	/* Configure humidity oversampling */
 	reg_value = 0 | BME_OVERSAMPLING_1;
 	cmd[0] = BME_CTRL_HUM;
@@ -159,6 +169,8 @@ void BME_Read_Data(int *temp, uint32_t *press, uint32_t *hum)
 	*press = BME_press_comp(adc_P);
 	*hum = BME_hum_comp(adc_H);
 
+	PROBE_END(PROBE_BME_READ);
+
 }
 
 
@@ -0,0 +1,46 @@
+/*
+ * clock.h
+ *
+ *  Public interface of the RTC clock.
+ *  The STM32 RTC, clocked by the 32.768 kHz LSE crystal in the backup
+ *  domain, holds the UTC time to the second, in epoch seconds (see
+ *  date_converter.h). It is set from the sync response and keeps running
+ *  through resets and low-power modes (and power cuts with VBAT supplied).
+ *  Its alarm interrupt marks each real minute boundary.
+ *
+ *  The syncs also measure the drift of the crystal: the correction goes to
+ *  the RTC calibration, and the interval between syncs grows from
+ *  CLOCK_SYNC_MIN to CLOCK_SYNC_MAX while the RTC holds the time.
+ *
+ *  F103: the RTC is a 32-bit seconds counter, counting from 1 January 2000.
+ *  F072: the RTC is a BCD calendar, alarm A matches second 00.
+ */
+
+#ifndef CLOCK_INC_CLOCK_H_
+#define CLOCK_INC_CLOCK_H_
+
+#include <stdint.h>
+
+#define CLOCK_LSE_TIMEOUT 3000 // ms for the crystal to start, the LSI is used past it
+
+#define CLOCK_SYNC_MIN 360     // minutes between syncs while the drift is learned
+#define CLOCK_SYNC_MAX 5760    // 4 days, once the RTC holds the time
+#define CLOCK_DRIFT_MIN_MS 1500 // smaller offsets are the resolution of the network time
+#define CLOCK_DRIFT_MAX_S 600  // larger offsets are not drift, the RTC is set again
+#define CLOCK_BASELINE_MIN 3600 // s between two syncs to measure a rate
+#define CLOCK_TURNOVER 250     // 0.1 °C, the crystal runs fastest there
+#define CLOCK_TEMP_COEF 34     // 0.034 ppm / °C², in 0.001 ppm
+
+int Clock_Init(void);
+void Clock_Set(uint32_t time);
+uint32_t Clock_Get(void);
+void Clock_Sync(uint32_t net);
+uint16_t Clock_Sync_Interval(void);
+void Clock_Temperature(int temp);
+int16_t Clock_Get_Trim(void);
+void Clock_Set_Trim(int16_t trim);
+uint32_t Clock_Ms_Of_Day(void);
+uint8_t Clock_Minute_Elapsed(void);
+void Clock_Alarm_IRQHandler(void);
+
+#endif /* CLOCK_INC_CLOCK_H_ */
@@ -0,0 +1,569 @@
+/*
+ * clock.c
+ *
+ *  Description:
+ *  UTC time kept by the RTC, see clock.h.
+ *
+ *  Registers are accessed directly (the HAL RTC driver is not part of the
+ *  projects). The RTC clock source can only be chosen once after a backup
+ *  domain reset: an RTC already enabled is left running as it is.
+ *
+ *  Drift: each sync compares the RTC with the network time. An offset
+ *  within the resolution of the network time keeps the last reference (a
+ *  longer baseline measures a smaller drift) and doubles the interval to
+ *  the next sync. A larger offset gives the rate of the crystal over the
+ *  baseline, which corrects the trim written to the RTC calibration, and
+ *  halves the interval.
+ */
+
+#include "clock.h"
+#include "main.h"
+#include "date_converter.h"
+
+#define CLOCK_TRIM_STEP 9537         // one calibration pulse per 2^20 = 0.9537 ppm, in 0.0001 ppm
+
+static volatile uint8_t clock_minute_elapsed = 0;
+
+static int32_t clock_trim = 0;       // learned from the syncs, 0.01 ppm, > 0 speeds the clock up
+static int32_t clock_temp_trim = 0;  // crystal curve at the last temperature, 0.01 ppm
+static uint32_t clock_ref = 0;       // epoch seconds of the last sync that set the RTC, 0 = none
+static uint16_t clock_interval = CLOCK_SYNC_MIN;
+
+/**
+ * @brief  Start the LSE crystal and select it as the RTC clock, or the LSI
+ *         if the crystal does not start.
+ * @retval 1 for the LSE, 0 for the LSI
+ */
+static uint8_t Clock_Start_Source(void)
+{
+	uint32_t start = HAL_GetTick();
+
+	RCC->BDCR |= RCC_BDCR_LSEON;
+	while (!(RCC->BDCR & RCC_BDCR_LSERDY))
+	{
+		if (HAL_GetTick() - start > CLOCK_LSE_TIMEOUT)
+		{
+			RCC->BDCR &= ~RCC_BDCR_LSEON;
+			RCC->CSR |= RCC_CSR_LSION;
+			while (!(RCC->CSR & RCC_CSR_LSIRDY));
+			RCC->BDCR |= RCC_BDCR_RTCSEL_LSI | RCC_BDCR_RTCEN;
+			return 0;
+		}
+	}
+	RCC->BDCR |= RCC_BDCR_RTCSEL_LSE | RCC_BDCR_RTCEN;
+	return 1;
+}
+
+#if defined(STM32F1)
+
+#define CLOCK_PRESCALER_LSE 32767    // 32.768 kHz / (32767 + 1) = 1 Hz
+#define CLOCK_PRESCALER_LSI 39999    // 40 kHz, +-50 % over temperature
+#define CLOCK_SET_MIN (366UL * 86400) // a counter under 2001 was never set
+#define CLOCK_TRIM_MIN -12100        // 127 calibration steps
+#define CLOCK_TRIM_MAX 2500          // one prescaler count less, less the LSI one
+
+static uint32_t clock_prescaler = CLOCK_PRESCALER_LSE; // last value written, PRL is write only
+
+static uint32_t Clock_Nominal_Prescaler(void)
+{
+	return (RCC->BDCR & RCC_BDCR_RTCSEL) == RCC_BDCR_RTCSEL_LSI ? CLOCK_PRESCALER_LSI : CLOCK_PRESCALER_LSE;
+}
+
+static void Clock_Wait_Write(void)
+{
+	while (!(RTC->CRL & RTC_CRL_RTOFF));
+}
+
+static uint32_t Clock_Counter(void)
+{
+	uint16_t high = RTC->CNTH;
+	uint16_t low = RTC->CNTL;
+
+	if (RTC->CNTH != high) // carry between the two reads
+	{
+		high = RTC->CNTH;
+		low = RTC->CNTL;
+	}
+	return ((uint32_t)high << 16) | low;
+}
+
+static void Clock_Write_Prescaler(uint32_t prescaler)
+{
+	Clock_Wait_Write();
+	RTC->CRL |= RTC_CRL_CNF;
+	RTC->PRLH = prescaler >> 16;
+	RTC->PRLL = prescaler & 0xFFFF;
+	RTC->CRL &= ~RTC_CRL_CNF;
+	Clock_Wait_Write();
+	clock_prescaler = prescaler;
+}
+
+/**
+ * @brief  Alarm on the next minute boundary of the counter.
+ */
+static void Clock_Set_Alarm(uint32_t counter)
+{
+	uint32_t alarm = (counter / 60 + 1) * 60;
+
+	Clock_Wait_Write();
+	RTC->CRL |= RTC_CRL_CNF;
+	RTC->ALRH = alarm >> 16;
+	RTC->ALRL = alarm & 0xFFFF;
+	RTC->CRL &= ~RTC_CRL_CNF;
+	Clock_Wait_Write();
+}
+
+/**
+ * @brief  Start the RTC if needed and its minute alarm, call once at boot.
+ * @retval 0 if the RTC kept a time set before the reset, -1 if it was
+ *         started or never set (the time is then 1 January 2000)
+ */
+int Clock_Init(void)
+{
+	int ret = 0;
+
+	RCC->APB1ENR |= RCC_APB1ENR_PWREN | RCC_APB1ENR_BKPEN;
+	(void)RCC->APB1ENR;
+	PWR->CR |= PWR_CR_DBP;
+
+	if (!(RCC->BDCR & RCC_BDCR_RTCEN))
+	{
+		Clock_Start_Source();
+		Clock_Write_Prescaler(Clock_Nominal_Prescaler());
+		RTC->CRL |= RTC_CRL_CNF;
+		RTC->CNTH = 0;
+		RTC->CNTL = 0;
+		RTC->CRL &= ~RTC_CRL_CNF;
+		Clock_Wait_Write();
+		ret = -1;
+	}
+	else if ((RCC->BDCR & RCC_BDCR_RTCSEL) == RCC_BDCR_RTCSEL_LSI)
+	{
+		/* the LSI is not in the backup domain, it stopped with the reset */
+		RCC->CSR |= RCC_CSR_LSION;
+		while (!(RCC->CSR & RCC_CSR_LSIRDY));
+		ret = -1;
+	}
+	/* a trimmed prescaler is written again by Clock_Set_Trim */
+	clock_prescaler = Clock_Nominal_Prescaler();
+
+	/* the registers read back are only valid after an RTC clock edge */
+	RTC->CRL &= ~RTC_CRL_RSF;
+	while (!(RTC->CRL & RTC_CRL_RSF));
+
+	if (Clock_Counter() < CLOCK_SET_MIN)
+		ret = -1;
+
+	Clock_Set_Alarm(Clock_Counter());
+	RTC->CRL &= ~RTC_CRL_ALRF;
+	RTC->CRH |= RTC_CRH_ALRIE;
+	EXTI->IMR |= EXTI_IMR_MR17;
+	EXTI->RTSR |= EXTI_RTSR_TR17;
+	EXTI->PR = EXTI_PR_PR17;
+	NVIC_SetPriority(RTC_Alarm_IRQn, 0);
+	NVIC_EnableIRQ(RTC_Alarm_IRQn);
+
+	return ret;
+}
+
+/**
+ * @brief  Set the time, the next alarm comes on the next minute.
+ * @param  time: epoch seconds, UTC
+ */
+void Clock_Set(uint32_t time)
+{
+	uint32_t counter = time - DATE_EPOCH_2000;
+
+	Clock_Wait_Write();
+	RTC->CRL |= RTC_CRL_CNF;
+	RTC->CNTH = counter >> 16;
+	RTC->CNTL = counter & 0xFFFF;
+	RTC->CRL &= ~RTC_CRL_CNF;
+	Clock_Wait_Write();
+
+	Clock_Set_Alarm(counter);
+}
+
+/**
+ * @brief  Epoch seconds and milliseconds of the second, from the counter
+ *         (seconds since 1 January 2000) and the prescaler divider (it
+ *         counts down from the prescaler value to 0 each second).
+ */
+static uint32_t Clock_Now(uint32_t *ms)
+{
+	/* after a wake up from STOP the registers read back are stale until the next RTC clock edge */
+	RTC->CRL &= ~RTC_CRL_RSF;
+	while (!(RTC->CRL & RTC_CRL_RSF));
+
+	uint32_t div = ((uint32_t)(RTC->DIVH & 0x0F) << 16) | RTC->DIVL;
+	uint32_t counter = Clock_Counter();
+	uint32_t div_after = ((uint32_t)(RTC->DIVH & 0x0F) << 16) | RTC->DIVL;
+
+	if (div_after > div) // the second changed between the reads
+	{
+		div = div_after;
+		counter = Clock_Counter();
+	}
+	if (div > clock_prescaler)
+		div = clock_prescaler;
+	*ms = (clock_prescaler - div) * 1000 / (clock_prescaler + 1);
+	return counter + DATE_EPOCH_2000;
+}
+
+/**
+ * @brief  Write a trim to the RTC. One prescaler count less runs the clock
+ *         fast by 30.5 ppm (LSE), the calibration register then slows it
+ *         down by steps of 0.95 ppm.
+ */
+static void Clock_Apply_Trim(int32_t trim)
+{
+	uint32_t prescaler = Clock_Nominal_Prescaler();
+	int32_t slow = -trim;
+	uint32_t cal = 0;
+
+	if (trim > 0)
+	{
+		slow += 100000000L / (int32_t)(prescaler + 1);
+		prescaler--;
+	}
+	if (slow > 0)
+		cal = ((uint32_t)slow * 100 + CLOCK_TRIM_STEP / 2) / CLOCK_TRIM_STEP;
+	if (cal > BKP_RTCCR_CAL)
+		cal = BKP_RTCCR_CAL;
+
+	BKP->RTCCR = (BKP->RTCCR & ~BKP_RTCCR_CAL) | cal;
+	if (prescaler != clock_prescaler)
+		Clock_Write_Prescaler(prescaler);
+}
+
+/**
+ * @brief  RTC alarm (EXTI line 17), call from RTC_Alarm_IRQHandler.
+ */
+void Clock_Alarm_IRQHandler(void)
+{
+	EXTI->PR = EXTI_PR_PR17;
+	if (RTC->CRL & RTC_CRL_ALRF)
+	{
+		RTC->CRL &= ~RTC_CRL_ALRF;
+		Clock_Set_Alarm(Clock_Counter());
+		clock_minute_elapsed = 1;
+	}
+}
+
+#else
+
+#define CLOCK_PREDIV_A_LSE 127       // 32.768 kHz / 128 / 256 = 1 Hz
+#define CLOCK_PREDIV_S_LSE 255
+#define CLOCK_PREDIV_A_LSI 99        // 40 kHz / 100 / 400 = 1 Hz
+#define CLOCK_PREDIV_S_LSI 399
+#define CLOCK_TRIM_CALP 48828        // CALP adds 512 pulses per 2^20 = 488.28 ppm
+#define CLOCK_TRIM_MIN -48700        // 511 CALM steps
+#define CLOCK_TRIM_MAX 48800
+
+static uint8_t Clock_To_BCD(uint8_t value)
+{
+	return ((value / 10) << 4) | (value % 10);
+}
+
+static uint8_t Clock_From_BCD(uint8_t bcd)
+{
+	return (bcd >> 4) * 10 + (bcd & 0x0F);
+}
+
+static void Clock_Unlock(void)
+{
+	RTC->WPR = 0xCA;
+	RTC->WPR = 0x53;
+}
+
+static void Clock_Lock(void)
+{
+	RTC->WPR = 0xFF;
+}
+
+/**
+ * @brief  Wait until the calendar registers read back the running RTC,
+ *         needed after a reset and a wake up from STOP.
+ */
+static void Clock_Wait_Sync(void)
+{
+	Clock_Unlock();
+	RTC->ISR &= ~RTC_ISR_RSF;
+	Clock_Lock();
+	while (!(RTC->ISR & RTC_ISR_RSF));
+}
+
+/**
+ * @brief  Start the RTC if needed and its minute alarm, call once at boot.
+ * @retval 0 if the RTC kept a time set before the reset, -1 if it was
+ *         started or never set (the time is then 1 January 2000)
+ */
+int Clock_Init(void)
+{
+	int ret = 0;
+
+	RCC->APB1ENR |= RCC_APB1ENR_PWREN;
+	(void)RCC->APB1ENR;
+	PWR->CR |= PWR_CR_DBP;
+
+	if (!(RCC->BDCR & RCC_BDCR_RTCEN))
+	{
+		uint8_t lse = Clock_Start_Source();
+
+		Clock_Unlock();
+		RTC->ISR |= RTC_ISR_INIT;
+		while (!(RTC->ISR & RTC_ISR_INITF));
+		RTC->PRER = lse ? CLOCK_PREDIV_S_LSE : CLOCK_PREDIV_S_LSI;
+		RTC->PRER |= (uint32_t)(lse ? CLOCK_PREDIV_A_LSE : CLOCK_PREDIV_A_LSI) << 16;
+		RTC->ISR &= ~RTC_ISR_INIT;
+		Clock_Lock();
+		ret = -1;
+	}
+	else if ((RCC->BDCR & RCC_BDCR_RTCSEL) == RCC_BDCR_RTCSEL_LSI)
+	{
+		/* the LSI is not in the backup domain, it stopped with the reset */
+		RCC->CSR |= RCC_CSR_LSION;
+		while (!(RCC->CSR & RCC_CSR_LSIRDY));
+		ret = -1;
+	}
+
+	/* the year is 0 until the first Clock_Set */
+	if (!(RTC->ISR & RTC_ISR_INITS))
+		ret = -1;
+
+	/* alarm A on second 00 of every minute */
+	Clock_Unlock();
+	RTC->CR &= ~RTC_CR_ALRAE;
+	while (!(RTC->ISR & RTC_ISR_ALRAWF));
+	RTC->ALRMAR = RTC_ALRMAR_MSK4 | RTC_ALRMAR_MSK3 | RTC_ALRMAR_MSK2;
+	RTC->CR |= RTC_CR_ALRAIE | RTC_CR_ALRAE;
+	Clock_Lock();
+	Clock_Wait_Sync();
+
+	EXTI->IMR |= EXTI_IMR_MR17;
+	EXTI->RTSR |= EXTI_RTSR_TR17;
+	EXTI->PR = EXTI_PR_PR17;
+	NVIC_SetPriority(RTC_IRQn, 0);
+	NVIC_EnableIRQ(RTC_IRQn);
+
+	return ret;
+}
+
+/**
+ * @brief  Set the time, the alarm keeps matching second 00.
+ * @param  time: epoch seconds, UTC
+ */
+void Clock_Set(uint32_t time)
+{
+	Date_Time date;
+
+	Date_From_Epoch(time, &date);
+	uint32_t tr = ((uint32_t)Clock_To_BCD(date.minute / 60) << 16)
+			| ((uint32_t)Clock_To_BCD(date.minute % 60) << 8)
+			| Clock_To_BCD(date.second);
+	uint32_t dr = ((uint32_t)Clock_To_BCD(date.yy - 2000) << 16)
+			| ((uint32_t)(date.day + 1) << 13)                   // 1 = monday
+			| ((uint32_t)Clock_To_BCD(date.mm + 1) << 8)
+			| Clock_To_BCD(date.dd);
+
+	Clock_Unlock();
+	RTC->ISR |= RTC_ISR_INIT;
+	while (!(RTC->ISR & RTC_ISR_INITF));
+	RTC->TR = tr;
+	RTC->DR = dr;
+	RTC->ISR &= ~RTC_ISR_INIT;
+	Clock_Lock();
+	Clock_Wait_Sync();
+}
+
+/**
+ * @brief  Epoch seconds and milliseconds of the second, from the calendar
+ *         and the sub-second register (it counts down from PREDIV_S to 0
+ *         each second).
+ */
+static uint32_t Clock_Now(uint32_t *ms)
+{
+	uint32_t prediv_s = RTC->PRER & RTC_PRER_PREDIV_S;
+
+	Clock_Wait_Sync();
+
+	uint32_t ss = RTC->SSR; // reading SSR holds TR and DR until DR is read
+	uint32_t tr = RTC->TR;
+	uint32_t dr = RTC->DR;
+
+	if (ss > prediv_s) // a calibration shift is in progress
+		ss = prediv_s;
+	*ms = (prediv_s - ss) * 1000 / (prediv_s + 1);
+
+	uint32_t days = Date_Days(2000 + Clock_From_BCD((dr >> 16) & 0xFF), Clock_From_BCD((dr >> 8) & 0x1F) - 1, Clock_From_BCD(dr & 0x3F));
+	return days * 86400 + Clock_From_BCD((tr >> 16) & 0x3F) * 3600UL + Clock_From_BCD((tr >> 8) & 0x7F) * 60 + Clock_From_BCD(tr & 0x7F);
+}
+
+/**
+ * @brief  Write a trim to the smooth calibration. CALP runs the clock fast
+ *         by 488.3 ppm, CALM slows it down by steps of 0.95 ppm.
+ */
+static void Clock_Apply_Trim(int32_t trim)
+{
+	uint32_t calr = 0;
+	int32_t slow = -trim;
+	uint32_t calm = 0;
+
+	if (trim > 0)
+	{
+		calr = RTC_CALR_CALP;
+		slow += CLOCK_TRIM_CALP;
+	}
+	if (slow > 0)
+		calm = ((uint32_t)slow * 100 + CLOCK_TRIM_STEP / 2) / CLOCK_TRIM_STEP;
+	if (calm > RTC_CALR_CALM)
+		calm = RTC_CALR_CALM;
+	calr |= calm;
+
+	if ((RTC->CALR & (RTC_CALR_CALP | RTC_CALR_CALM)) == calr)
+		return;
+	Clock_Unlock();
+	while (RTC->ISR & RTC_ISR_RECALPF);
+	RTC->CALR = calr;
+	Clock_Lock();
+}
+
+/**
+ * @brief  RTC alarm A (EXTI line 17), call from RTC_IRQHandler.
+ */
+void Clock_Alarm_IRQHandler(void)
+{
+	EXTI->PR = EXTI_PR_PR17;
+	if (RTC->ISR & RTC_ISR_ALRAF)
+	{
+		RTC->ISR = ~(RTC_ISR_ALRAF | RTC_ISR_INIT) | (RTC->ISR & RTC_ISR_INIT);
+		clock_minute_elapsed = 1;
+	}
+}
+
+#endif
+
+/**
+ * @brief  Current time.
+ * @retval epoch seconds, UTC
+ */
+uint32_t Clock_Get(void)
+{
+	uint32_t ms;
+
+	return Clock_Now(&ms);
+}
+
+/**
+ * @brief  Milliseconds since midnight.
+ */
+uint32_t Clock_Ms_Of_Day(void)
+{
+	uint32_t ms;
+	uint32_t now = Clock_Now(&ms);
+
+	return (now % 86400) * 1000 + ms;
+}
+
+static void Clock_Limit_Trim(void)
+{
+	if (clock_trim > CLOCK_TRIM_MAX)
+		clock_trim = CLOCK_TRIM_MAX;
+	if (clock_trim < CLOCK_TRIM_MIN)
+		clock_trim = CLOCK_TRIM_MIN;
+	Clock_Apply_Trim(clock_trim + clock_temp_trim);
+}
+
+/**
+ * @brief  Set the RTC from the network time, learn the drift of the crystal
+ *         from the offset found and choose the interval to the next sync.
+ * @param  net: epoch seconds, UTC, truncated to the second
+ */
+void Clock_Sync(uint32_t net)
+{
+	uint32_t ms;
+	uint32_t now = Clock_Now(&ms);
+	int32_t diff = (int32_t)(now - net);
+	int32_t elapsed = (int32_t)(net - clock_ref);
+
+	if (clock_ref == 0 || diff > CLOCK_DRIFT_MAX_S || diff < -CLOCK_DRIFT_MAX_S || elapsed < CLOCK_BASELINE_MIN)
+	{
+		/* first sync, time lost or baseline too short: only a new reference */
+		Clock_Set(net);
+		clock_ref = net;
+		clock_interval = CLOCK_SYNC_MIN;
+		return;
+	}
+
+	/* the network second is half over on average */
+	int32_t offset = diff * 1000 + (int32_t)ms - 500;
+
+	if (offset < CLOCK_DRIFT_MIN_MS && offset > -CLOCK_DRIFT_MIN_MS)
+	{
+		/* the RTC holds the time: leave it, the baseline grows */
+		clock_interval = clock_interval > CLOCK_SYNC_MAX / 2 ? CLOCK_SYNC_MAX : clock_interval * 2;
+		return;
+	}
+
+	/* rate over the baseline in 0.01 ppm, > 0 when the clock runs fast */
+	clock_trim -= offset * 1000 / (elapsed / 100);
+	Clock_Limit_Trim();
+
+	Clock_Set(net);
+	clock_ref = net;
+	clock_interval = clock_interval < CLOCK_SYNC_MIN * 2 ? CLOCK_SYNC_MIN : clock_interval / 2;
+}
+
+/**
+ * @brief  Minutes to wait before the next sync.
+ */
+uint16_t Clock_Sync_Interval(void)
+{
+	return clock_interval;
+}
+
+/**
+ * @brief  Follow the crystal curve: a tuning fork crystal runs slow by
+ *         0.034 ppm per squared degree away from its turnover temperature.
+ * @param  temp: 0.1 °C
+ */
+void Clock_Temperature(int temp)
+{
+	int32_t delta = temp - CLOCK_TURNOVER;
+
+	if (delta > 600 || delta < -600) // not a temperature, a sensor error
+		return;
+	clock_temp_trim = delta * delta * CLOCK_TEMP_COEF / 1000;
+	Clock_Apply_Trim(clock_trim + clock_temp_trim);
+}
+
+/**
+ * @brief  Learned trim, saved for a warm restart.
+ * @retval 0.1 ppm, > 0 speeds the clock up
+ */
+int16_t Clock_Get_Trim(void)
+{
+	return (int16_t)(clock_trim / 10);
+}
+
+/**
+ * @brief  Restore the learned trim after a reset.
+ * @param  trim: 0.1 ppm, from Clock_Get_Trim
+ */
+void Clock_Set_Trim(int16_t trim)
+{
+	clock_trim = trim * 10L;
+	Clock_Limit_Trim();
+}
+
+/**
+ * @brief  A minute boundary passed since the last call.
+ * @retval 1 once per RTC alarm, 0 otherwise
+ */
+uint8_t Clock_Minute_Elapsed(void)
+{
+	if (!clock_minute_elapsed)
+		return 0;
+	clock_minute_elapsed = 0;
+	return 1;
+}
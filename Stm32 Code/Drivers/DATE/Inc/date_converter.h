@@ -0,0 +1,106 @@
+/*
+ * date_converter.h
+ *
+ *  Created on: Jan 17, 2026
+ *      Author: Valentin
+ *
+ *  Public interface for date and time conversion utilities.
+ *  This module provides:
+ *   - Epoch seconds <-> civil date and time, in constant time
+ *   - Moon phase calculation
+ *  The local time of a zone is in time_zone.h.
+ *
+ *  Time is carried as one 32-bit count of seconds since 1 January 1970
+ *  (valid up to 2105), the date and time fields are derived from it.
+ */
+
+#ifndef DATE_INC_DATE_CONVERTER_H_
+#define DATE_INC_DATE_CONVERTER_H_
+
+#include "main.h"
+#include <stdint.h>
+
+#define DATE_EPOCH_2000 946684800UL /* 1 January 2000, in epoch seconds */
+
+/* Civil date and time of an epoch second */
+typedef struct
+{
+	uint8_t day;      // day of the week, 0 = monday
+	uint8_t dd;       // day of month, 1 to 31
+	uint8_t mm;       // month, 0 = january
+	uint16_t yy;      // 1970 to 2105
+	uint16_t minute;  // minutes since midnight
+	uint8_t second;
+} Date_Time;
+
+/**
+ * @brief Days since 1 January 1970 of a date
+ *
+ * @param yy Full year (1970 to 2105)
+ * @param mm Month index (0 = January ... 11 = December)
+ * @param dd Day of month (1–31)
+ * @return Day count, 0 for 1 January 1970
+ */
+uint32_t Date_Days(uint16_t yy, uint8_t mm, uint8_t dd);
+
+/**
+ * @brief Date of a day count since 1 January 1970, inverse of Date_Days
+ *
+ * Fills dd, mm, yy and the day of the week, the time fields are left as they are.
+ *
+ * @param days Day count since 1 January 1970
+ * @param time Date to fill
+ */
+void Date_From_Days(uint32_t days, Date_Time *time);
+
+/**
+ * @brief Day of the week of a day count
+ *
+ * @param days Day count since 1 January 1970
+ * @return Day of week (0 = Monday ... 6 = Sunday)
+ */
+uint8_t Date_Weekday(uint32_t days);
+
+/**
+ * @brief Epoch seconds of a date and time
+ *
+ * The day of the week of the fields is not used.
+ *
+ * @param time Date and time
+ * @return Seconds since 1 January 1970
+ */
+uint32_t Date_To_Epoch(const Date_Time *time);
+
+/**
+ * @brief Date and time of epoch seconds, inverse of Date_To_Epoch
+ *
+ * @param epoch Seconds since 1 January 1970
+ * @param time  Date and time to fill
+ */
+void Date_From_Epoch(uint32_t epoch, Date_Time *time);
+
+/**
+ * @brief Compute the moon phase for a given date
+ *
+ * The calculation is based on a reference new moon
+ * (1 March 2014) and the average synodic month duration,
+ * in integer arithmetic (1e-5 day units, valid until 2131).
+ *
+ * @param day   Day of month (1–31)
+ * @param month Month index (0 = January ... 11 = December)
+ * @param year  Full year (e.g. 2026)
+ *
+ * @return Moon phase index:
+ *         0 = New Moon
+ *         1 = Waxing Crescent
+ *         2 = First Quarter
+ *         3 = Waxing Gibbous
+ *         4 = Full Moon
+ *         5 = Waning Gibbous
+ *         6 = Last Quarter
+ *         7 = Waning Crescent
+ */
+uint8_t Moon_Phase(uint8_t day, uint8_t month, uint16_t year);
+
+
+#endif /* DATE_INC_DATE_CONVERTER_H_ */
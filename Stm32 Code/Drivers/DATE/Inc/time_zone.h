@@ -0,0 +1,68 @@
+/*
+ * time_zone.h
+ *
+ *  Public interface of the time zone rules.
+ *  Each zone is a line of a table written after its POSIX TZ string: the
+ *  standard and summer offsets and the two "Mm.w.d/time" change dates.
+ *  The zone is chosen at build time (TZ_ZONE) and can be changed at run
+ *  time with TZ_Select, main keeps it with the warm restart state.
+ *
+ *  TZ_Local works out the UTC instants of the changes around the time
+ *  asked and keeps the period in force: until the next change, which comes
+ *  twice a year, the local time is one comparison and one add.
+ */
+
+#ifndef DATE_INC_TIME_ZONE_H_
+#define DATE_INC_TIME_ZONE_H_
+
+#include <stdint.h>
+
+/* Zones of the table */
+typedef enum
+{
+	TZ_UTC = 0,        // UTC0
+	TZ_LONDON,         // GMT0BST,M3.5.0/1,M10.5.0
+	TZ_PARIS,          // CET-1CEST,M3.5.0,M10.5.0/3
+	TZ_HELSINKI,       // EET-2EEST,M3.5.0/3,M10.5.0/4
+	TZ_MOSCOW,         // MSK-3
+	TZ_KOLKATA,        // IST-5:30
+	TZ_SHANGHAI,       // CST-8
+	TZ_TOKYO,          // JST-9
+	TZ_SYDNEY,         // AEST-10AEDT,M10.1.0,M4.1.0/3
+	TZ_AUCKLAND,       // NZST-12NZDT,M9.5.0,M4.1.0/3
+	TZ_SAO_PAULO,      // <-03>3
+	TZ_NEW_YORK,       // EST5EDT,M3.2.0,M11.1.0
+	TZ_CHICAGO,        // CST6CDT,M3.2.0,M11.1.0
+	TZ_DENVER,         // MST7MDT,M3.2.0,M11.1.0
+	TZ_PHOENIX,        // MST7
+	TZ_LOS_ANGELES,    // PST8PDT,M3.2.0,M11.1.0
+	TZ_COUNT
+} TZ_Zone;
+
+#ifndef TZ_ZONE
+#define TZ_ZONE TZ_PARIS   // zone at power on, e.g. -DTZ_ZONE=TZ_NEW_YORK
+#endif
+
+/* Change date of a rule, POSIX "Mm.w.d/time" */
+typedef struct
+{
+	uint8_t month;     // 1 = january
+	uint8_t week;      // 1 to 5, 5 = last of the month
+	uint8_t weekday;   // 0 = sunday
+	int16_t minute;    // local time of the change, minutes since midnight
+} TZ_Change;
+
+/* Rule of a zone */
+typedef struct
+{
+	int16_t std;       // standard offset, minutes east of UTC (POSIX "CET-1" is +60)
+	int16_t dst;       // summer offset, equal to std without summer time
+	TZ_Change start;   // to summer time, in standard time
+	TZ_Change end;     // back to standard time, in summer time
+} TZ_Rule;
+
+void TZ_Select(uint8_t zone);
+uint8_t TZ_Get(void);
+uint32_t TZ_Local(uint32_t utc);
+
+#endif /* DATE_INC_TIME_ZONE_H_ */
@@ -0,0 +1,140 @@
+/*
+ * date_converter.c
+ *
+ *  Created on: Jan 17, 2026
+ *      Author: Valentin
+ *
+ *  This file provides:
+ *   - Epoch seconds <-> civil date conversion and day of week
+ *   - Moon phase calculation
+ */
+
+#include "date_converter.h"
+#include "probe.h"
+
+/* Days are counted from 1 March 1600, the start of a 400 year cycle, so that
+   the leap day is the last day of each year: no loop and no month table */
+#define DATE_ERA_DAYS 146097UL     /* days in 400 years */
+#define DATE_EPOCH_DAYS 135080UL   /* 1 March 1600 to 1 January 1970 */
+
+/* Average lunar cycle, 29.53058867 days, in 1e-5 day: the day counts up to
+   2131 fit in 32 bits with this unit */
+#define MOON_CYCLE_E5 2953059UL
+#define MOON_DAY_E5 100000UL
+#define MOON_REF_DAYS 16130UL      /* 1 March 2014, a new moon */
+
+/* End of each moon phase, moon age in tenths of a day */
+static const uint16_t moon_phase_end[8] = {18, 55, 92, 129, 166, 203, 240, 277};
+
+/**
+ * @brief Days since 1 January 1970 of a date
+ *
+ * @param yy Full year
+ * @param mm Month index (0 = January)
+ * @param dd Day of month
+ * @return Day count
+ */
+uint32_t Date_Days(uint16_t yy, uint8_t mm, uint8_t dd)
+{
+    uint32_t y = yy - 1600 - (mm < 2);
+    uint32_t m = mm < 2 ? mm + 10 : mm - 2;                  /* 0 = March */
+    uint32_t doy = (153 * m + 2) / 5 + dd - 1;
+
+    return y * 365 + y / 4 - y / 100 + y / 400 + doy - DATE_EPOCH_DAYS;
+}
+
+/**
+ * @brief Date of a day count since 1 January 1970
+ *
+ * @param days Day count
+ * @param time Date to fill (dd, mm, yy, day)
+ */
+void Date_From_Days(uint32_t days, Date_Time *time)
+{
+    uint32_t z = days + DATE_EPOCH_DAYS;
+    uint32_t era = z / DATE_ERA_DAYS;
+    uint32_t doe = z - era * DATE_ERA_DAYS;                  /* day of the 400 year cycle */
+    uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);   /* day from 1 March */
+    uint32_t m = (5 * doy + 2) / 153;                        /* 0 = March */
+
+    time->dd = doy - (153 * m + 2) / 5 + 1;
+    time->mm = m < 10 ? m + 2 : m - 10;
+    time->yy = 1600 + era * 400 + yoe + (time->mm < 2);
+    time->day = Date_Weekday(days);
+}
+
+/**
+ * @brief Day of the week of a day count
+ *
+ * @param days Day count since 1 January 1970
+ * @return Day of week (0 = Monday ... 6 = Sunday)
+ */
+uint8_t Date_Weekday(uint32_t days)
+{
+    return (days + 3) % 7;  /* 1 January 1970 was a Thursday */
+}
+
+/**
+ * @brief Epoch seconds of a date and time
+ *
+ * @param time Date and time
+ * @return Seconds since 1 January 1970
+ */
+uint32_t Date_To_Epoch(const Date_Time *time)
+{
+    return Date_Days(time->yy, time->mm, time->dd) * 86400 + time->minute * 60UL + time->second;
+}
+
+/**
+ * @brief Date and time of epoch seconds
+ *
+ * @param epoch Seconds since 1 January 1970
+ * @param time  Date and time to fill
+ */
+void Date_From_Epoch(uint32_t epoch, Date_Time *time)
+{
+    uint32_t seconds = epoch % 86400;
+
+    Date_From_Days(epoch / 86400, time);
+    time->minute = seconds / 60;
+    time->second = seconds % 60;
+}
+
+/**
+ * @brief Calculate moon phase
+ *
+ * @param day   Day of month
+ * @param month Month index (0 = January)
+ * @param year  Full year
+ * @return Moon phase index (0–7)
+ */
+uint8_t Moon_Phase(uint8_t day, uint8_t month, uint16_t year)
+{
+	uint8_t phase;
+
+	PROBE_BEGIN(PROBE_MOON_PHASE);
+
+	/* Days since the reference new moon */
+	uint32_t days = Date_Days(year, month, day);
+
+	/* Moon age within the cycle, in 1e-5 day (no soft-float on the M0 / M3) */
+	uint32_t age;
+	if (days >= MOON_REF_DAYS) {
+		age = ((days - MOON_REF_DAYS) * MOON_DAY_E5) % MOON_CYCLE_E5;
+	} else {
+		age = ((MOON_REF_DAYS - days) * MOON_DAY_E5) % MOON_CYCLE_E5;
+		if (age != 0) age = MOON_CYCLE_E5 - age;
+	}
+
+	/* Phase determination, on the age in tenths of a day */
+	uint32_t age_10 = age / (MOON_DAY_E5 / 10);
+	phase = 0;
+	while (phase < 8 && age_10 >= moon_phase_end[phase]) {
+		phase++;
+	}
+	if (phase == 8) phase = 0;
+
+	PROBE_END(PROBE_MOON_PHASE);
+	return phase;
+}
@@ -0,0 +1,144 @@
+/*
+ * time_zone.c
+ *
+ *  Description:
+ *  Local time from UTC with a table of zone rules, see time_zone.h.
+ */
+
+#include "time_zone.h"
+#include "date_converter.h"
+#include "probe.h"
+
+#define TZ_NO_DST {0, 0, 0, 0}
+
+static const TZ_Rule tz_rules[TZ_COUNT] =
+{
+	[TZ_UTC]         = {   0,    0, TZ_NO_DST, TZ_NO_DST },
+	[TZ_LONDON]      = {   0,   60, {3, 5, 0, 60}, {10, 5, 0, 120} },
+	[TZ_PARIS]       = {  60,  120, {3, 5, 0, 120}, {10, 5, 0, 180} },
+	[TZ_HELSINKI]    = { 120,  180, {3, 5, 0, 180}, {10, 5, 0, 240} },
+	[TZ_MOSCOW]      = { 180,  180, TZ_NO_DST, TZ_NO_DST },
+	[TZ_KOLKATA]     = { 330,  330, TZ_NO_DST, TZ_NO_DST },
+	[TZ_SHANGHAI]    = { 480,  480, TZ_NO_DST, TZ_NO_DST },
+	[TZ_TOKYO]       = { 540,  540, TZ_NO_DST, TZ_NO_DST },
+	[TZ_SYDNEY]      = { 600,  660, {10, 1, 0, 120}, {4, 1, 0, 180} },
+	[TZ_AUCKLAND]    = { 720,  780, {9, 5, 0, 120}, {4, 1, 0, 180} },
+	[TZ_SAO_PAULO]   = {-180, -180, TZ_NO_DST, TZ_NO_DST },
+	[TZ_NEW_YORK]    = {-300, -240, {3, 2, 0, 120}, {11, 1, 0, 120} },
+	[TZ_CHICAGO]     = {-360, -300, {3, 2, 0, 120}, {11, 1, 0, 120} },
+	[TZ_DENVER]      = {-420, -360, {3, 2, 0, 120}, {11, 1, 0, 120} },
+	[TZ_PHOENIX]     = {-420, -420, TZ_NO_DST, TZ_NO_DST },
+	[TZ_LOS_ANGELES] = {-480, -420, {3, 2, 0, 120}, {11, 1, 0, 120} },
+};
+
+static uint8_t tz_zone = TZ_ZONE;
+
+/* Period between two changes: utc - tz_from < tz_span has the offset tz_offset */
+static uint32_t tz_from = 0;
+static uint32_t tz_span = 0;       // 0 = to work out
+static int32_t tz_offset = 0;      // seconds
+
+/**
+ * @brief  UTC instant of a change in a year.
+ * @param  before: offset in force before the change, minutes
+ */
+static uint32_t TZ_Change_Time(const TZ_Change *change, uint16_t year, int16_t before)
+{
+	uint8_t month = change->month - 1;
+	uint32_t first = Date_Days(year, month, 1);
+	uint32_t end = month == 11 ? Date_Days(year + 1, 0, 1) : Date_Days(year, month + 1, 1);
+	uint8_t first_weekday = (Date_Weekday(first) + 1) % 7;  // 0 = sunday, as in the rule
+	uint32_t day = first + (change->weekday + 7 - first_weekday) % 7 + (change->week - 1) * 7;
+
+	while (day >= end) // week 5: the last one
+		day -= 7;
+	return day * 86400 + change->minute * 60L - before * 60L;
+}
+
+/**
+ * @brief  Find the period of a time: the last change before it, the next
+ *         one and the offset in between, from the changes of the year
+ *         before to those of the year after.
+ */
+static void TZ_Update(uint32_t utc)
+{
+	const TZ_Rule *rule = &tz_rules[tz_zone];
+	Date_Time date;
+	uint32_t prev = 0;
+	uint32_t next = UINT32_MAX;
+	int16_t offset = rule->std;
+
+	if (rule->dst == rule->std)
+	{
+		tz_from = 0;
+		tz_span = UINT32_MAX;
+		tz_offset = rule->std * 60L;
+		return;
+	}
+
+	Date_From_Days(utc / 86400, &date);
+	for (uint16_t year = date.yy > 1970 ? date.yy - 1 : 1970; year <= date.yy + 1; year++)
+	{
+		uint32_t start = TZ_Change_Time(&rule->start, year, rule->std);
+		uint32_t end = TZ_Change_Time(&rule->end, year, rule->dst);
+
+		if (start <= utc && start >= prev)
+		{
+			prev = start;
+			offset = rule->dst;
+		}
+		if (end <= utc && end >= prev)
+		{
+			prev = end;
+			offset = rule->std;
+		}
+		if (start > utc && start < next)
+			next = start;
+		if (end > utc && end < next)
+			next = end;
+	}
+
+	tz_from = prev;
+	tz_span = next - prev;
+	tz_offset = offset * 60L;
+}
+
+/**
+ * @brief  Choose the zone of TZ_Local, from the TZ_Zone table.
+ */
+void TZ_Select(uint8_t zone)
+{
+	if (zone >= TZ_COUNT)
+		return;
+	tz_zone = zone;
+	tz_span = 0;
+}
+
+/**
+ * @brief  Zone in use.
+ * @retval TZ_Zone
+ */
+uint8_t TZ_Get(void)
+{
+	return tz_zone;
+}
+
+/**
+ * @brief  Local time of the selected zone.
+ * @param  utc: epoch seconds, UTC
+ * @retval epoch seconds, local time
+ */
+uint32_t TZ_Local(uint32_t utc)
+{
+	uint32_t local;
+
+	PROBE_BEGIN(PROBE_TZ_LOCAL);
+
+	/* a change passed (or the time went back): the new period, twice a year */
+	if (utc - tz_from >= tz_span)
+		TZ_Update(utc);
+	local = utc + tz_offset;
+
+	PROBE_END(PROBE_TZ_LOCAL);
+	return local;
+}
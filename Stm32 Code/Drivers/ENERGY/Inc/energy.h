@@ -0,0 +1,99 @@
+/*
+ * energy.h
+ *
+ *  Public interface of the energy accounting.
+ *  This module keeps how long each subsystem was active since boot (panel
+ *  BUSY, ESP-01 AT sessions, I2C transactions, CPU sleeping or stopped)
+ *  and, with the current model below, estimates the charge used per hour
+ *  and per day.
+ *
+ *  Build with ENERGY_ENABLE=1 to enable it, the hooks compile to nothing
+ *  otherwise (ENERGY_SLEEP() is then a plain __WFI()).
+ */
+
+#ifndef ENERGY_INC_ENERGY_H_
+#define ENERGY_INC_ENERGY_H_
+
+#include <stdint.h>
+
+#ifndef ENERGY_ENABLE
+#define ENERGY_ENABLE 0
+#endif
+
+/* Current model in uA, override them in the project symbols with the values
+   measured on your board */
+#ifndef ENERGY_CPU_RUN_UA
+#define ENERGY_CPU_RUN_UA 25000      // MCU awake, clocks and peripherals on
+#endif
+#ifndef ENERGY_CPU_SLEEP_UA
+#define ENERGY_CPU_SLEEP_UA 8000     // MCU in __WFI, peripherals still clocked
+#endif
+#ifndef ENERGY_CPU_STOP_UA
+#define ENERGY_CPU_STOP_UA 30        // MCU in STOP, regulator in low-power mode
+#endif
+#ifndef ENERGY_PANEL_UA
+#define ENERGY_PANEL_UA 6000         // panel while BUSY (refresh, power on)
+#endif
+#ifndef ENERGY_WIFI_ACTIVE_UA
+#define ENERGY_WIFI_ACTIVE_UA 80000  // ESP-01 during an AT session
+#endif
+#ifndef ENERGY_WIFI_IDLE_UA
+#define ENERGY_WIFI_IDLE_UA 20000    // ESP-01 powered between sessions (no CH_PD control)
+#endif
+#ifndef ENERGY_I2C_UA
+#define ENERGY_I2C_UA 1000           // BME280 and pull-ups during a transaction
+#endif
+
+/* Subsystems, the derived ones are the uptime minus a measured one */
+typedef enum
+{
+	ENERGY_CPU_RUN = 0,     // derived: uptime - ENERGY_CPU_SLEEP - ENERGY_CPU_STOP
+	ENERGY_CPU_SLEEP,
+	ENERGY_CPU_STOP,
+	ENERGY_PANEL,
+	ENERGY_WIFI_ACTIVE,
+	ENERGY_WIFI_IDLE,       // derived: uptime - ENERGY_WIFI_ACTIVE
+	ENERGY_I2C,
+	ENERGY_COUNT
+} Energy_Id;
+
+/* Accounting since Energy_Init or the last reset */
+typedef struct
+{
+	uint32_t uptime_ms;
+	uint32_t active_ms[ENERGY_COUNT];
+	uint32_t charge_uah[ENERGY_COUNT];  // active time x current of the model
+	uint32_t total_uah;
+	uint32_t hour_uah;                  // total scaled to one hour of uptime
+	uint32_t day_uah;                   // total scaled to one day of uptime
+} Energy_Report;
+
+/* Writes len characters of a dump, e.g. to a UART */
+typedef void (*Energy_Writer)(const char *text, uint16_t len);
+
+#if ENERGY_ENABLE
+
+void Energy_Init(void);
+void Energy_Start(Energy_Id id);
+void Energy_Stop(Energy_Id id);
+void Energy_Add_Ms(Energy_Id id, uint32_t ms);
+void Energy_Sleep(void);
+void Energy_Get_Report(Energy_Report *report);
+void Energy_Dump(Energy_Writer write);
+void Energy_Reset(void);
+
+#define ENERGY_START(id) Energy_Start(id)
+#define ENERGY_STOP(id) Energy_Stop(id)
+#define ENERGY_ADD_MS(id, ms) Energy_Add_Ms(id, ms)
+#define ENERGY_SLEEP() Energy_Sleep()
+
+#else
+
+#define ENERGY_START(id) ((void)0)
+#define ENERGY_STOP(id) ((void)0)
+#define ENERGY_ADD_MS(id, ms) ((void)0)
+#define ENERGY_SLEEP() __WFI()
+
+#endif
+
+#endif /* ENERGY_INC_ENERGY_H_ */
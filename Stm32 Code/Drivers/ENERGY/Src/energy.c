@@ -0,0 +1,172 @@
+/*
+ * energy.c
+ *
+ *  Description:
+ *  Active time of each subsystem and charge estimate, see energy.h.
+ *
+ *  Times are counted in core cycles (Port_Cycles) so the short ones, a
+ *  __WFI woken by the next SysTick or an I2C transaction, are not lost to
+ *  the 1 ms HAL tick.
+ */
+
+#include "energy.h"
+
+#if ENERGY_ENABLE
+
+#include "main.h"
+#include "port.h"
+#include <stdio.h>
+#include <string.h>
+
+#define ENERGY_LONG_MS 30000 // longer intervals are timed with the HAL tick, Port_Cycles wraps
+
+static const char *const energy_names[ENERGY_COUNT] = {
+	"cpu_run",
+	"cpu_sleep",
+	"cpu_stop",
+	"panel",
+	"wifi_active",
+	"wifi_idle",
+	"i2c",
+};
+
+static const uint32_t energy_current_ua[ENERGY_COUNT] = {
+	ENERGY_CPU_RUN_UA,
+	ENERGY_CPU_SLEEP_UA,
+	ENERGY_CPU_STOP_UA,
+	ENERGY_PANEL_UA,
+	ENERGY_WIFI_ACTIVE_UA,
+	ENERGY_WIFI_IDLE_UA,
+	ENERGY_I2C_UA,
+};
+
+static uint64_t energy_cycles[ENERGY_COUNT];  // measured subsystems only
+static uint32_t energy_start_cycles[ENERGY_COUNT];
+static uint32_t energy_start_tick[ENERGY_COUNT];
+static uint32_t energy_boot_tick = 0;
+
+/**
+ * @brief  Start the accounting, call once after SystemClock_Config.
+ */
+void Energy_Init(void)
+{
+	Energy_Reset();
+}
+
+/**
+ * @brief  A subsystem becomes active.
+ */
+void Energy_Start(Energy_Id id)
+{
+	energy_start_tick[id] = HAL_GetTick();
+	energy_start_cycles[id] = Port_Cycles();
+}
+
+/**
+ * @brief  The subsystem started by Energy_Start is idle again.
+ */
+void Energy_Stop(Energy_Id id)
+{
+	uint32_t cycles = Port_Cycles() - energy_start_cycles[id];
+	uint32_t ms = HAL_GetTick() - energy_start_tick[id];
+
+	if (ms > ENERGY_LONG_MS)
+		energy_cycles[id] += (uint64_t)ms * (SystemCoreClock / 1000);
+	else
+		energy_cycles[id] += cycles;
+}
+
+/**
+ * @brief  Add an active time measured elsewhere (e.g. the panel BUSY time).
+ */
+void Energy_Add_Ms(Energy_Id id, uint32_t ms)
+{
+	energy_cycles[id] += (uint64_t)ms * (SystemCoreClock / 1000);
+}
+
+/**
+ * @brief  __WFI counted as CPU sleep time, use it for every idle wait.
+ */
+void Energy_Sleep(void)
+{
+	uint32_t start = Port_Cycles();
+
+	__WFI();
+	energy_cycles[ENERGY_CPU_SLEEP] += Port_Cycles() - start;
+}
+
+/**
+ * @brief  Active times and charge estimate since the last reset.
+ * @param  report Filled by the function.
+ */
+void Energy_Get_Report(Energy_Report *report)
+{
+	uint32_t cycles_per_ms = SystemCoreClock / 1000;
+	uint64_t total = 0;
+
+	memset(report, 0, sizeof(*report));
+	report->uptime_ms = HAL_GetTick() - energy_boot_tick;
+
+	for (uint8_t id = 0; id < ENERGY_COUNT; id++)
+	{
+		uint32_t ms = (uint32_t)(energy_cycles[id] / cycles_per_ms);
+		report->active_ms[id] = ms < report->uptime_ms ? ms : report->uptime_ms;
+	}
+	uint32_t idle_ms = report->active_ms[ENERGY_CPU_SLEEP] + report->active_ms[ENERGY_CPU_STOP];
+	report->active_ms[ENERGY_CPU_RUN] = idle_ms < report->uptime_ms ? report->uptime_ms - idle_ms : 0;
+	report->active_ms[ENERGY_WIFI_IDLE] = report->uptime_ms - report->active_ms[ENERGY_WIFI_ACTIVE];
+
+	for (uint8_t id = 0; id < ENERGY_COUNT; id++)
+	{
+		/* uA x ms / 3600000 = uAh */
+		uint64_t charge = (uint64_t)energy_current_ua[id] * report->active_ms[id];
+
+		report->charge_uah[id] = (uint32_t)(charge / 3600000);
+		total += charge;
+	}
+	report->total_uah = (uint32_t)(total / 3600000);
+	if (report->uptime_ms)
+	{
+		report->hour_uah = (uint32_t)(total / report->uptime_ms);
+		report->day_uah = (uint32_t)(total * 24 / report->uptime_ms);
+	}
+}
+
+/**
+ * @brief  Write the report as text, one line per subsystem.
+ * @param  write Output, called once per line
+ */
+void Energy_Dump(Energy_Writer write)
+{
+	Energy_Report report;
+	char line[80];
+	int len;
+
+	Energy_Get_Report(&report);
+	len = snprintf(line, sizeof(line), "energy over %lu ms\r\n", (unsigned long)report.uptime_ms);
+	write(line, len);
+	for (uint8_t id = 0; id < ENERGY_COUNT; id++)
+	{
+		uint64_t charge = (uint64_t)energy_current_ua[id] * report.active_ms[id];
+		uint32_t day = report.uptime_ms ? (uint32_t)(charge * 24 / report.uptime_ms) : 0;
+
+		len = snprintf(line, sizeof(line), "%-12s %10lu ms %6lu uA %8lu uAh %8lu uAh/day\r\n", energy_names[id],
+				(unsigned long)report.active_ms[id], (unsigned long)energy_current_ua[id],
+				(unsigned long)report.charge_uah[id], (unsigned long)day);
+		write(line, len);
+	}
+	len = snprintf(line, sizeof(line), "total %lu uAh, %lu uAh/h, %lu uAh/day\r\n",
+			(unsigned long)report.total_uah, (unsigned long)report.hour_uah, (unsigned long)report.day_uah);
+	write(line, len);
+}
+
+/**
+ * @brief  Start a new accounting period.
+ */
+void Energy_Reset(void)
+{
+	memset(energy_cycles, 0, sizeof(energy_cycles));
+	energy_boot_tick = HAL_GetTick();
+}
+
+#endif
@@ -0,0 +1,85 @@
+
+
+#ifndef _DRIVER_H_
+#define _DRIVER_H_
+
+#include "main.h"
+#include "port.h"
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * e-Paper GPIO
+ **/
+#define EPAPER_RST_PIN RST_Pin
+#define EPAPER_RST_PORT RST_GPIO_Port
+
+#define EPAPER_DC_PIN DC_Pin
+#define EPAPER_DC_PORT DC_GPIO_Port
+
+#define EPAPER_CS_PIN SPI_CS_Pin
+#define EPAPER_CS_PORT SPI_CS_GPIO_Port
+#define EPAPER_CS_PIN_NUM 4 // PA4 doubles as SPI1_NSS
+
+#define EPAPER_BUSY_PIN BUSY_Pin
+#define EPAPER_BUSY_PORT BUSY_GPIO_Port
+
+#define EPAPER_MOSI_PIN DIN_Pin
+#define EPAPER_MOSI_PORT DIN_GPIO_Port
+
+#define EPAPER_SCLK_PIN SCK_Pin
+#define EPAPER_SCLK_PORT SCK_GPIO_Port
+
+#define EPAPER_SPI SPI1
+
+/**
+ * Bulk data transfer (DMA, one CS pulse per byte done by hardware)
+ *  - parts with SPI NSS pulse mode (F0) : SPI1_NSS on PA4, DMA1 channel 3
+ *  - other parts (F1) : TIM2 paces the bytes, DMA1 channel 2 (CS low),
+ *    channel 1 (SPI1->DR) and channel 7 (CS high, end of transfer IRQ)
+ **/
+#define EPAPER_TRANSFER_MAX 0xFFFF     // bytes per DMA transfer
+#define EPAPER_TRANSFER_TIMEOUT 1000   // ms
+#define EPAPER_CS_SETUP_TICKS 4        // timer ticks between CS low and first clock
+#define EPAPER_CS_HIGH_TICKS 8         // timer ticks CS stays high between bytes
+
+typedef void (*EPAPER_Transfer_Callback)(void);
+
+/**
+ * BUSY pin (low while the controller works), end of busy on EXTI rising edge
+ **/
+#if defined(STM32F1)
+#define EPAPER_BUSY_IRQn EXTI0_IRQn
+#else
+#define EPAPER_BUSY_IRQn EXTI0_1_IRQn
+#endif
+#define EPAPER_BUSY_GUARD 2        // ms, BUSY is asserted well before this
+#define EPAPER_BUSY_TIMEOUT 30000  // ms
+
+void SPI_WriteByte(uint8_t value);
+void SPI_Write_nByte(uint8_t *value, uint32_t len);
+
+void EPAPER_GPIO_Init(void);
+void EPAPER_GPIO_Exit(void);
+
+void EPAPER_Reset(void);
+void EPAPER_SendCommand(uint8_t Reg);
+void EPAPER_SendData(uint8_t Data);
+void EPAPER_Send_nData(const uint8_t *pData, uint32_t Len);
+void EPAPER_Send_Fill(uint8_t Data, uint32_t Len);
+void EPAPER_ReadBusy(void);
+
+void EPAPER_Busy_Init(void);
+void EPAPER_Busy_Start(EPAPER_Transfer_Callback done);
+uint8_t EPAPER_Busy(void);
+uint32_t EPAPER_Busy_Time(void);
+uint32_t EPAPER_Busy_Total(void);
+void EPAPER_Busy_IRQHandler(void);
+
+void EPAPER_Transfer_Init(void);
+int EPAPER_Send_nData_DMA(const uint8_t *pData, uint32_t Len, EPAPER_Transfer_Callback done);
+int EPAPER_Send_Fill_DMA(uint8_t Data, uint32_t Len, EPAPER_Transfer_Callback done);
+uint8_t EPAPER_Transfer_Busy(void);
+int EPAPER_Transfer_Wait(void);
+void EPAPER_Transfer_IRQHandler(void);
+#endif
@@ -0,0 +1,115 @@
+
+#ifndef __EPAPER_H_
+#define __EPAPER_H_
+
+#include "DRIVER.h"
+#include "EPAPER_Asset.h"
+#include "EPAPER_LUT.h"
+
+// Display resolution
+#define EPAPER_WIDTH 240
+#define EPAPER_HEIGHT 360
+#define EPAPER_BUFFER_SIZE ((EPAPER_WIDTH*EPAPER_HEIGHT)/8)
+#define EPAPER_BYTE_WIDTH (EPAPER_WIDTH/8)
+
+// Clockwise rotation, in quarter turns
+typedef enum
+{
+    EPAPER_ROTATE_0 = 0,
+    EPAPER_ROTATE_90,
+    EPAPER_ROTATE_180,
+    EPAPER_ROTATE_270
+} EPAPER_Rotation;
+
+// Screen (as read) to panel rotation, layout code works in screen coordinates
+#define EPAPER_ROTATION EPAPER_ROTATE_90
+#define EPAPER_SCREEN_WIDTH ((EPAPER_ROTATION & 1) ? EPAPER_HEIGHT : EPAPER_WIDTH)
+#define EPAPER_SCREEN_HEIGHT ((EPAPER_ROTATION & 1) ? EPAPER_WIDTH : EPAPER_HEIGHT)
+
+// pixel_font.c glyphs and pixel_assets.c bitmaps are stored turned by this
+#define EPAPER_FONT_ROTATION EPAPER_ROTATE_90
+
+// EPAPER_Print_String scales its text this many screen columns at a time
+#define EPAPER_TEXT_CHUNK 64
+
+// Sun and moon icons are 32x32
+#define EPAPER_ICON_SIZE 32
+
+// Maximum number of separate regions kept between two EPAPER_Flush
+#define EPAPER_DIRTY_MAX 4
+
+// 8x8 pixel tiles of the image on the panel kept until the next flush, for
+// the old data plane (10 bytes each). A minute update touches about 90;
+// tiles past the journal are sent with every pixel driven. The F072 has
+// 4 KB less RAM and keeps fewer.
+#define EPAPER_TILES (EPAPER_BYTE_WIDTH * (EPAPER_HEIGHT / 8))
+#ifndef EPAPER_JOURNAL_TILES
+#if defined(STM32F0)
+#define EPAPER_JOURNAL_TILES 40
+#else
+#define EPAPER_JOURNAL_TILES 96
+#endif
+#endif
+
+// Red plane of the (B) panel, sent EPAPER_RED_BAND lines at a time
+#define EPAPER_RED_BAND 8
+#define EPAPER_RED_POLARITY 0xFF    // XOR from ink bits (0 = ink) to red data (1 = red)
+
+#define WHITE 0x00
+#define BLACK 0xFF
+#define RED 0x0F
+
+#define LUTGC_TEST //
+#define LUTDU_TEST //
+
+// Panel region, end points are inclusive
+typedef struct
+{
+    uint16_t x_start;
+    uint16_t y_start;
+    uint16_t x_end;
+    uint16_t y_end;
+} EPAPER_Rect;
+
+// Draws a layer with the usual drawing functions, see EPAPER_Red_Layer
+typedef void (*EPAPER_Draw_Callback)(void);
+
+void EPAPER_Init(void);
+void EPAPER_Init_Fast(void);
+void EPAPER_Part_Init(void);
+void EPAPER_refresh(void);
+void EPAPER_Refresh_Start(EPAPER_Transfer_Callback done);
+uint8_t EPAPER_Refresh_Poll(void);
+void EPAPER_Refresh_Wait(void);
+void EPAPER_Refresh_Mode(EPAPER_LUT_Mode mode);
+void EPAPER_Set_Temperature(int temp);
+void EPAPER_KW_Partial_Display(const uint8_t *new_image, uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height);
+void EPAPER_FB_Blit(const uint8_t *image, uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height);
+void EPAPER_FB_Blit_Rotate(const uint8_t *image, uint16_t width, uint16_t height, uint16_t x_start, uint16_t y_start, EPAPER_Rotation rotation);
+void EPAPER_Draw_Image(const uint8_t *image, uint16_t width, uint16_t height, EPAPER_Rotation stored, uint16_t x, uint16_t y);
+void EPAPER_FB_Fill(uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height, uint8_t color);
+void EPAPER_Draw_Rect(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t color);
+void EPAPER_Red_Layer(EPAPER_Draw_Callback draw);
+void EPAPER_Red_Invalidate(void);
+uint8_t EPAPER_Red_Flush(void);
+uint8_t EPAPER_Flush_Start(EPAPER_Transfer_Callback done);
+void EPAPER_Flush(void);
+void EPAPER_KW_White_Display(void);
+void EPAPER_Clear(void);
+void EPAPER_Clean_Region(const EPAPER_Rect *rect);
+void EPAPER_Full_Refresh(void);
+void EPAPER_Restore_Display(void);
+void EPAPER_lut(void);
+void EPAPER_Dup_Bits(const uint8_t input, uint8_t *output, uint8_t mult);
+void EPAPER_Size_Mult(const uint8_t *image, uint8_t *mult_image, uint8_t mult, uint16_t byte_width, uint16_t height);
+void EPAPER_Print_Bitmap(const EPAPER_Bitmap *bitmap, uint16_t x_start, uint16_t y_start);
+void EPAPER_Print_Char(const uint8_t *image,  uint8_t size, uint16_t x_start, uint16_t y_start);
+void EPAPER_Print_String(const char *string,  uint8_t size, uint16_t x_start, uint16_t x_end, uint16_t y_start);
+void EPAPER_Print_Hour(uint16_t min,  uint16_t prev_min);
+void EPAPER_Print_Moon_Phase(uint8_t moon_phase, uint16_t min, uint16_t rise_time, uint16_t fall_time);
+void EPAPER_Print_Date(uint8_t day,  uint8_t dd, uint8_t mm);
+void EPAPER_Print_temp(int temp);
+void EPAPER_Print_press(uint32_t press);
+void EPAPER_Print_hum(uint32_t hum);
+
+#endif
@@ -0,0 +1,43 @@
+/*
+ * EPAPER_Asset.h
+ *
+ *  Compressed bitmaps and fonts built by tools/asset_compiler.py, and the
+ *  streaming decoder that expands them line by line.
+ */
+
+#ifndef EPAPER_LIB_INC_EPAPER_ASSET_H_
+#define EPAPER_LIB_INC_EPAPER_ASSET_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Compressed 1 bit image, in the panel layout (1 = white)
+typedef struct
+{
+    uint16_t width;         // pixels along x, multiple of 8
+    uint16_t height;        // lines along y
+    const uint8_t *data;    // run length stream, see tools/asset_compiler.py
+} EPAPER_Bitmap;
+
+// Font made of the contiguous characters first .. first+count-1
+typedef struct
+{
+    char first;
+    uint8_t count;
+    const EPAPER_Bitmap *glyph;
+} EPAPER_Font;
+
+// Decoder state, lets a bitmap be expanded a few bytes at a time
+typedef struct
+{
+    const uint8_t *src;
+    uint8_t high;           // next count is the high nibble of *src
+    uint8_t color;          // colour of the current run, 0xFF white 0x00 black
+    uint16_t run;           // pixels left in the current run
+} EPAPER_RLE;
+
+void EPAPER_RLE_Init(EPAPER_RLE *rle, const EPAPER_Bitmap *bitmap);
+void EPAPER_RLE_Read(EPAPER_RLE *rle, uint8_t *out, uint16_t len);
+const EPAPER_Bitmap *EPAPER_Font_Glyph(const EPAPER_Font *font, char c);
+
+#endif /* EPAPER_LIB_INC_EPAPER_ASSET_H_ */
@@ -0,0 +1,63 @@
+/*
+ * EPAPER_Ghost.h
+ *
+ *  Ghosting bookkeeping: the panel is split in zones, each one counts the
+ *  partial refreshes it went through since its last clean (full waveform)
+ *  refresh. The scheduler cleans the zones that are due, preferably during
+ *  the quiet hours, instead of clearing the whole screen at fixed times.
+ */
+
+#ifndef EPAPER_LIB_INC_EPAPER_GHOST_H_
+#define EPAPER_LIB_INC_EPAPER_GHOST_H_
+
+#include "EPAPER.h"
+
+// Zone grid in panel coordinates, zone width is a multiple of 8
+#define EPAPER_GHOST_COLS 5
+#define EPAPER_GHOST_ROWS 6
+#define EPAPER_GHOST_ZONES (EPAPER_GHOST_COLS * EPAPER_GHOST_ROWS)
+#define EPAPER_GHOST_ZONE_WIDTH (EPAPER_WIDTH / EPAPER_GHOST_COLS)
+#define EPAPER_GHOST_ZONE_HEIGHT (EPAPER_HEIGHT / EPAPER_GHOST_ROWS)
+
+// State of one zone since its last clean refresh
+typedef struct
+{
+    uint16_t count;     // partial refreshes
+    uint16_t age;       // minutes since the first of them
+} EPAPER_Ghost_Zone;
+
+// When zones are cleaned, may be changed at run time
+typedef struct
+{
+    uint16_t max_count;     // partial refreshes before a zone is due
+    uint16_t max_age;       // minutes before a touched zone is due
+    uint8_t full_zones;     // due zones from which the whole screen is cleaned
+    uint8_t urgent;         // past max_* times this, do not wait for quiet hours
+    uint16_t quiet_start;   // quiet hours, minute of the day
+    uint16_t quiet_end;
+} EPAPER_Ghost_Policy;
+
+// Clean refreshes done since boot
+typedef struct
+{
+    uint32_t regions;       // dirty regions sent with a partial waveform
+    uint32_t regional;      // zone cleans
+    uint32_t full;          // whole screen cleans
+} EPAPER_Ghost_Stats;
+
+typedef enum
+{
+    EPAPER_GHOST_NONE = 0,
+    EPAPER_GHOST_REGIONAL,
+    EPAPER_GHOST_FULL
+} EPAPER_Ghost_Action;
+
+extern EPAPER_Ghost_Policy EPAPER_ghost_policy;
+
+void EPAPER_Ghost_Account(const EPAPER_Rect *rect, EPAPER_LUT_Mode mode);
+void EPAPER_Ghost_Tick(void);
+EPAPER_Ghost_Action EPAPER_Ghost_Service(uint16_t minute);
+const EPAPER_Ghost_Zone *EPAPER_Ghost_Zones(void);
+const EPAPER_Ghost_Stats *EPAPER_Ghost_Get_Stats(void);
+
+#endif /* EPAPER_LIB_INC_EPAPER_GHOST_H_ */
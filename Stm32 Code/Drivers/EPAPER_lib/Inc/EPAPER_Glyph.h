@@ -0,0 +1,19 @@
+/*
+ * EPAPER_Glyph.h
+ *
+ *  Bit expansion tables, the data lives in EPAPER_Glyph.c which is
+ *  generated by tools/gen_glyph.py.
+ */
+
+#ifndef EPAPER_LIB_INC_EPAPER_GLYPH_H_
+#define EPAPER_LIB_INC_EPAPER_GLYPH_H_
+
+#include <stdint.h>
+
+// Scale factors covered by EPAPER_expand
+#define EPAPER_EXPAND_MAX 8
+
+// EPAPER_expand[mult] + byte*mult -> mult bytes, each bit repeated mult times
+extern const uint8_t * const EPAPER_expand[EPAPER_EXPAND_MAX + 1];
+
+#endif /* EPAPER_LIB_INC_EPAPER_GLYPH_H_ */
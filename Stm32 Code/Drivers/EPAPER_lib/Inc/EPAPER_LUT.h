@@ -0,0 +1,41 @@
+
+
+#ifndef EPAPER_LUT_H_
+#define EPAPER_LUT_H_
+
+#include <stdint.h>
+
+#define EPAPER_LUT_SIZE 42      // bytes per waveform register
+#define EPAPER_LUT_BANDS 4
+#define EPAPER_LUT_HYSTERESIS 5 // 0.1 °C, margin before leaving a band
+
+// Waveform profiles, chosen per refresh
+typedef enum
+{
+	EPAPER_LUT_FAST = 0,    // direct update, only changing pixels are driven
+	EPAPER_LUT_PARTIAL,     // normal partial update
+	EPAPER_LUT_FULL,        // long waveform for full screen clears
+	EPAPER_LUT_COUNT
+} EPAPER_LUT_Mode;
+
+// The five waveform registers 0x20 - 0x24
+typedef struct
+{
+	const uint8_t *vcom;
+	const uint8_t *ww;
+	const uint8_t *bw;
+	const uint8_t *wb;
+	const uint8_t *bb;
+} EPAPER_LUT_Set;
+
+// Temperature band, frame counts are scaled by scale/16 from min_temp up
+typedef struct
+{
+	int16_t min_temp;   // 0.1 °C, same unit as BME_Read_Data
+	uint8_t scale;
+} EPAPER_LUT_Band;
+
+extern const EPAPER_LUT_Set EPAPER_lut_set[EPAPER_LUT_COUNT];
+extern const EPAPER_LUT_Band EPAPER_lut_band[EPAPER_LUT_BANDS];
+
+#endif /* EPAPER_LIB_INC_EPAPER_LUT_H_ */
@@ -0,0 +1,105 @@
+/*
+ * EPAPER_Trace.h
+ *
+ *  Optional recorder of the command stream sent to the panel: commands with
+ *  their data byte counts, partial windows and BUSY times, grouped in
+ *  sections tagged with the drawing calls they come from. The trace lives in
+ *  RAM and is dumped as text, tools/trace_decode.py summarizes it.
+ *
+ *  Build with EPAPER_TRACE=1 to enable it, the hooks compile to nothing
+ *  otherwise.
+ */
+
+#ifndef EPAPER_LIB_INC_EPAPER_TRACE_H_
+#define EPAPER_LIB_INC_EPAPER_TRACE_H_
+
+#include <stdint.h>
+
+#ifndef EPAPER_TRACE
+#define EPAPER_TRACE 0
+#endif
+
+// Records kept, 8 bytes each, the oldest are overwritten (a minute update
+// takes about 40, dump and reset the trace after each one)
+#ifndef EPAPER_TRACE_RECORDS
+#define EPAPER_TRACE_RECORDS 128
+#endif
+
+typedef enum
+{
+    EPAPER_TRACE_UPDATE = 'U',  // start of a logical update, value = tick
+    EPAPER_TRACE_SECTION = 'S', // cmd = section kind, arg = tags, value = tick
+    EPAPER_TRACE_COMMAND = 'C', // arg = data bytes that followed, value = ms to send them
+    EPAPER_TRACE_WINDOW = 'W',  // value = width (px) << 16 | height
+    EPAPER_TRACE_BUSY = 'B',    // cmd = last command before it, value = ms
+} EPAPER_Trace_Type;
+
+// What a section of an update sends
+typedef enum
+{
+    EPAPER_SECTION_REGION = 0,  // one dirty region, both data planes
+    EPAPER_SECTION_STALE,       // old plane of the regions of the last flush
+    EPAPER_SECTION_LUT,         // waveform upload
+    EPAPER_SECTION_REFRESH,     // window and refresh of the whole update
+    EPAPER_SECTION_SCREEN,      // full screen operation (clear, white, red)
+    EPAPER_SECTION_INIT,
+} EPAPER_Trace_Section_Kind;
+
+// Drawing calls, one bit each in the tags of a section
+typedef enum
+{
+    EPAPER_TAG_OTHER = 0,       // direct frame buffer drawing
+    EPAPER_TAG_DATE,
+    EPAPER_TAG_HOUR,
+    EPAPER_TAG_MOON,
+    EPAPER_TAG_TEMP,
+    EPAPER_TAG_PRESS,
+    EPAPER_TAG_HUM,
+    EPAPER_TAG_CLEAN,           // regions cleaned by EPAPER_Ghost
+    EPAPER_TAG_RED,
+} EPAPER_Trace_Tag;
+
+typedef struct
+{
+    uint8_t type;               // EPAPER_Trace_Type
+    uint8_t cmd;
+    uint16_t arg;
+    uint32_t value;
+} EPAPER_Trace_Record;
+
+// Writes len characters of a dump, e.g. to a UART
+typedef void (*EPAPER_Trace_Writer)(const char *text, uint16_t len);
+
+#if EPAPER_TRACE
+
+void EPAPER_Trace_Command(uint8_t cmd);
+void EPAPER_Trace_Data(const uint8_t *data, uint32_t len);
+void EPAPER_Trace_Busy(uint32_t ms);
+void EPAPER_Trace_Update(void);
+void EPAPER_Trace_Section(EPAPER_Trace_Section_Kind kind, uint16_t tags);
+void EPAPER_Trace_Set_Tag(EPAPER_Trace_Tag tag);
+uint16_t EPAPER_Trace_Tags(void);
+void EPAPER_Trace_Dump(EPAPER_Trace_Writer write);
+void EPAPER_Trace_Reset(void);
+
+#define EPAPER_TRACE_COMMAND(cmd) EPAPER_Trace_Command(cmd)
+#define EPAPER_TRACE_DATA(data, len) EPAPER_Trace_Data(data, len)
+#define EPAPER_TRACE_BUSY(ms) EPAPER_Trace_Busy(ms)
+#define EPAPER_TRACE_UPDATE() EPAPER_Trace_Update()
+#define EPAPER_TRACE_SECTION(kind, tags) EPAPER_Trace_Section(kind, tags)
+#define EPAPER_TRACE_TAG(tag) EPAPER_Trace_Set_Tag(tag)
+#define EPAPER_TRACE_TAGS() EPAPER_Trace_Tags()
+
+#else
+
+#define EPAPER_TRACE_COMMAND(cmd) ((void)0)
+#define EPAPER_TRACE_DATA(data, len) ((void)0)
+#define EPAPER_TRACE_BUSY(ms) ((void)0)
+#define EPAPER_TRACE_UPDATE() ((void)0)
+#define EPAPER_TRACE_SECTION(kind, tags) ((void)0)
+#define EPAPER_TRACE_TAG(tag) ((void)0)
+#define EPAPER_TRACE_TAGS() 0
+
+#endif
+
+#endif /* EPAPER_LIB_INC_EPAPER_TRACE_H_ */
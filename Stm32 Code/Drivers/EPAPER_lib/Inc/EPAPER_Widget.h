@@ -0,0 +1,55 @@
+/*
+ * EPAPER_Widget.h
+ *
+ *  Retained display elements: each widget keeps the values it shows, redraws
+ *  itself in the frame buffer when one of them changes and all the changes of
+ *  a pass go to the panel with one refresh. The frame buffer being wiped
+ *  (EPAPER_KW_White_Display) makes every widget draw itself again.
+ */
+
+#ifndef EPAPER_LIB_INC_EPAPER_WIDGET_H_
+#define EPAPER_LIB_INC_EPAPER_WIDGET_H_
+
+#include "EPAPER.h"
+
+#define EPAPER_WIDGET_MAX 8       // registered widgets
+#define EPAPER_WIDGET_VALUES 3    // values per widget
+
+// Widget state flags
+#define EPAPER_WIDGET_CHANGED 0x01  // a value differs from the one on screen
+#define EPAPER_WIDGET_REDRAW 0x02   // nothing of it is on screen, draw it all
+
+typedef struct EPAPER_Widget EPAPER_Widget;
+
+// Draws value[] in the frame buffer, shown[] holds what is on screen unless
+// state has EPAPER_WIDGET_REDRAW
+typedef void (*EPAPER_Widget_Render)(const EPAPER_Widget *widget);
+
+struct EPAPER_Widget
+{
+    uint16_t x;                     // screen area it draws in
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    EPAPER_Widget_Render render;
+    int16_t value[EPAPER_WIDGET_VALUES];
+    int16_t shown[EPAPER_WIDGET_VALUES];
+    uint8_t state;
+};
+
+// Elements of the clock screen, values in the order of their EPAPER_Print_* call
+extern EPAPER_Widget EPAPER_widget_hour;      // minute of the day
+extern EPAPER_Widget EPAPER_widget_date;      // day of the week, day, month
+extern EPAPER_Widget EPAPER_widget_sky;       // moon phase, minute of the day
+extern EPAPER_Widget EPAPER_widget_temp;      // 0.1 °C
+extern EPAPER_Widget EPAPER_widget_press;     // hPa
+extern EPAPER_Widget EPAPER_widget_hum;       // %
+
+int EPAPER_Widget_Register(EPAPER_Widget *widget);
+int EPAPER_Widget_Set(EPAPER_Widget *widget, uint8_t index, int16_t value);
+void EPAPER_Widget_Invalidate(void);
+void EPAPER_Widget_Invalidate_Area(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+void EPAPER_Widget_Draw(void);
+uint8_t EPAPER_Widget_Update(EPAPER_Transfer_Callback done);
+
+#endif /* EPAPER_LIB_INC_EPAPER_WIDGET_H_ */
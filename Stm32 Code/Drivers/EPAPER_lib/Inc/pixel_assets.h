@@ -0,0 +1,16 @@
+/*
+ * pixel_assets.h
+ *
+ *  Generated by tools/asset_compiler.py from tools/assets, do not edit.
+ */
+
+#ifndef EPAPER_LIB_INC_PIXEL_ASSETS_H_
+#define EPAPER_LIB_INC_PIXEL_ASSETS_H_
+
+#include "EPAPER_Asset.h"
+
+extern const EPAPER_Font digit_large;
+extern const EPAPER_Bitmap sun_icon;
+extern const EPAPER_Bitmap moon_icon[9];
+
+#endif /* EPAPER_LIB_INC_PIXEL_ASSETS_H_ */
@@ -12,8 +12,6 @@
 
 
 extern const uint8_t bpixel[];
-extern const uint8_t icone[];
-extern const uint8_t moon[];
 
 
 #endif /* EPAPER_LIB_INC_PIXEL_FONT_H_ */
@@ -0,0 +1,453 @@
+
+#include "DRIVER.h"
+#include "EPAPER_Trace.h"
+#include "energy.h"
+
+extern SPI_HandleTypeDef hspi1;
+
+static volatile uint8_t transfer_busy = 0;
+static EPAPER_Transfer_Callback transfer_done = NULL;
+static uint8_t transfer_fill;
+
+static volatile uint8_t busy_active = 0;
+static volatile uint32_t busy_start = 0;
+static volatile uint32_t busy_time = 0;   // last busy duration, ms
+static volatile uint32_t busy_total = 0;  // sum of all busy durations, ms
+static EPAPER_Transfer_Callback busy_done = NULL;
+
+#if !defined(SPI_CR2_NSSP)
+/* BSRR words written by DMA around each byte */
+static const uint32_t cs_low_word = (uint32_t)EPAPER_CS_PIN << 16;
+static const uint32_t cs_high_word = (uint32_t)EPAPER_CS_PIN;
+#endif
+
+void SPI_WriteByte(uint8_t value)
+{
+    Port_SPI_Write(EPAPER_SPI, value);
+}
+
+void SPI_Write_nByte(uint8_t *value, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++)
+        Port_SPI_Write(EPAPER_SPI, value[i]);
+}
+
+void EPAPER_GPIO_Init(void)
+{
+    Port_Pin_Write(EPAPER_DC_PORT, EPAPER_DC_PIN, 0);
+    Port_Pin_Write(EPAPER_CS_PORT, EPAPER_CS_PIN, 0);
+    Port_Pin_Write(EPAPER_RST_PORT, EPAPER_RST_PIN, 1);
+}
+
+void EPAPER_GPIO_Exit(void)
+{
+    Port_Pin_Write(EPAPER_DC_PORT, EPAPER_DC_PIN, 0);
+    Port_Pin_Write(EPAPER_CS_PORT, EPAPER_CS_PIN, 0);
+    Port_Pin_Write(EPAPER_RST_PORT, EPAPER_RST_PIN, 0);
+}
+
+/******************************************************************************
+function :	Software reset
+parameter:
+******************************************************************************/
+void EPAPER_Reset(void)
+{
+    Port_Pin_Write(EPAPER_RST_PORT, EPAPER_RST_PIN, 1);
+    HAL_Delay(200);
+    Port_Pin_Write(EPAPER_RST_PORT, EPAPER_RST_PIN, 0);
+    HAL_Delay(2);
+    Port_Pin_Write(EPAPER_RST_PORT, EPAPER_RST_PIN, 1);
+    HAL_Delay(200);
+}
+
+/******************************************************************************
+function :	send command
+parameter:
+     Reg : Command register
+******************************************************************************/
+void EPAPER_SendCommand(uint8_t Reg)
+{
+    EPAPER_TRACE_COMMAND(Reg);
+    Port_Pin_Write(EPAPER_DC_PORT, EPAPER_DC_PIN, 0);
+    Port_Pin_Write(EPAPER_CS_PORT, EPAPER_CS_PIN, 0);
+    SPI_WriteByte(Reg);
+    Port_Pin_Write(EPAPER_CS_PORT, EPAPER_CS_PIN, 1);
+}
+
+/******************************************************************************
+function :	send data
+parameter:
+    Data : Write data
+******************************************************************************/
+void EPAPER_SendData(uint8_t Data)
+{
+    Port_Pin_Write(EPAPER_DC_PORT, EPAPER_DC_PIN, 1);
+    Port_Pin_Write(EPAPER_CS_PORT, EPAPER_CS_PIN, 0);
+    SPI_WriteByte(Data);
+    Port_Pin_Write(EPAPER_CS_PORT, EPAPER_CS_PIN, 1);
+    EPAPER_TRACE_DATA(&Data, 1);
+}
+
+/******************************************************************************
+function :	send multiple data
+parameter:
+    Data : Write data
+    len  : data length
+
+Blocking, goes through the DMA engine so every byte gets its own CS pulse.
+******************************************************************************/
+void EPAPER_Send_nData(const uint8_t *Data, uint32_t len)
+{
+    uint32_t sent = 0;
+
+    while (sent < len)
+    {
+        uint32_t chunk = len - sent > EPAPER_TRANSFER_MAX ? EPAPER_TRANSFER_MAX : len - sent;
+        if (EPAPER_Send_nData_DMA(Data + sent, chunk, NULL) != 0 || EPAPER_Transfer_Wait() != 0)
+            break;
+        sent += chunk;
+    }
+    EPAPER_TRACE_DATA(Data, sent);
+}
+
+/******************************************************************************
+function :	send the same data byte len times
+parameter:
+    Data : Write data
+    len  : data length
+******************************************************************************/
+void EPAPER_Send_Fill(uint8_t Data, uint32_t len)
+{
+    uint32_t sent = 0;
+
+    while (sent < len)
+    {
+        uint32_t chunk = len - sent > EPAPER_TRANSFER_MAX ? EPAPER_TRANSFER_MAX : len - sent;
+        if (EPAPER_Send_Fill_DMA(Data, chunk, NULL) != 0 || EPAPER_Transfer_Wait() != 0)
+            break;
+        sent += chunk;
+    }
+    EPAPER_TRACE_DATA(NULL, sent);
+}
+
+/******************************************************************************
+function :	configure the bulk transfer engine, call once after MX_SPI1_Init
+parameter:
+******************************************************************************/
+void EPAPER_Transfer_Init(void)
+{
+    __HAL_RCC_DMA1_CLK_ENABLE();
+    __HAL_SPI_DISABLE(&hspi1);
+
+#if defined(SPI_CR2_NSSP)
+    /* hardware NSS with a pulse between consecutive bytes, PA4 is only
+       handed over to SPI1_NSS (AF0) while a transfer runs */
+    CLEAR_BIT(SPI1->CR1, SPI_CR1_SSM | SPI_CR1_SSI);
+    SET_BIT(SPI1->CR2, SPI_CR2_SSOE | SPI_CR2_NSSP);
+    MODIFY_REG(EPAPER_CS_PORT->AFR[0], 0xFU << (4 * EPAPER_CS_PIN_NUM), GPIO_AF0_SPI1 << (4 * EPAPER_CS_PIN_NUM));
+
+    DMA1_Channel3->CCR = 0;
+    DMA1_Channel3->CPAR = (uint32_t)&SPI1->DR;
+
+    HAL_NVIC_SetPriority(DMA1_Channel2_3_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel2_3_IRQn);
+#else
+    /* TIM2 runs at the SPI byte rate : update -> CS low, CC3 -> DR, CC2 -> CS high */
+    __HAL_RCC_TIM2_CLK_ENABLE();
+
+    uint32_t spi_div = 2U << ((SPI1->CR1 & SPI_CR1_BR) >> SPI_CR1_BR_Pos);
+    uint32_t tim_clk = HAL_RCC_GetPCLK1Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+        tim_clk *= 2;
+    uint32_t byte_ticks = (8U * spi_div * (tim_clk / 1000U)) / (HAL_RCC_GetPCLK2Freq() / 1000U);
+
+    TIM2->CR1 = 0;
+    TIM2->PSC = 0;
+    TIM2->CCR3 = EPAPER_CS_SETUP_TICKS;
+    TIM2->CCR2 = EPAPER_CS_SETUP_TICKS + byte_ticks + EPAPER_CS_SETUP_TICKS;
+    TIM2->ARR = TIM2->CCR2 + EPAPER_CS_HIGH_TICKS;
+    TIM2->EGR = TIM_EGR_UG;
+    TIM2->SR = 0;
+
+    DMA1_Channel1->CCR = 0;
+    DMA1_Channel1->CPAR = (uint32_t)&SPI1->DR;
+    DMA1_Channel2->CCR = 0;
+    DMA1_Channel2->CPAR = (uint32_t)&EPAPER_CS_PORT->BSRR;
+    DMA1_Channel7->CCR = 0;
+    DMA1_Channel7->CPAR = (uint32_t)&EPAPER_CS_PORT->BSRR;
+
+    HAL_NVIC_SetPriority(DMA1_Channel7_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel7_IRQn);
+#endif
+
+    __HAL_SPI_ENABLE(&hspi1);
+}
+
+/******************************************************************************
+function :	start a DMA data transfer
+parameter:
+    src       : first byte
+    len       : data length, 1 to EPAPER_TRANSFER_MAX
+    increment : 0 to send *src len times
+    done      : called from the IRQ once the last CS pulse is over, may be NULL
+******************************************************************************/
+static int EPAPER_Transfer_Start(const uint8_t *src, uint32_t len, uint8_t increment, EPAPER_Transfer_Callback done)
+{
+    if (transfer_busy || len == 0 || len > EPAPER_TRANSFER_MAX)
+        return -1;
+
+    transfer_busy = 1;
+    transfer_done = done;
+
+    Port_Pin_Write(EPAPER_DC_PORT, EPAPER_DC_PIN, 1);
+    Port_Pin_Write(EPAPER_CS_PORT, EPAPER_CS_PIN, 1);
+
+#if defined(SPI_CR2_NSSP)
+    DMA1_Channel3->CMAR = (uint32_t)src;
+    DMA1_Channel3->CNDTR = len;
+    DMA1_Channel3->CCR = DMA_CCR_DIR | DMA_CCR_PL_1 | DMA_CCR_TCIE | (increment ? DMA_CCR_MINC : 0);
+    DMA1_Channel3->CCR |= DMA_CCR_EN;
+
+    MODIFY_REG(EPAPER_CS_PORT->MODER, 3U << (2 * EPAPER_CS_PIN_NUM), 2U << (2 * EPAPER_CS_PIN_NUM)); // AF
+    SET_BIT(SPI1->CR2, SPI_CR2_TXDMAEN);
+#else
+    DMA1_Channel1->CMAR = (uint32_t)src;
+    DMA1_Channel1->CNDTR = len;
+    DMA1_Channel1->CCR = DMA_CCR_DIR | DMA_CCR_PL_1 | (increment ? DMA_CCR_MINC : 0) | DMA_CCR_EN;
+
+    DMA1_Channel2->CMAR = (uint32_t)&cs_low_word;
+    DMA1_Channel2->CNDTR = len;
+    DMA1_Channel2->CCR = DMA_CCR_DIR | DMA_CCR_PL_1 | DMA_CCR_MSIZE_1 | DMA_CCR_PSIZE_1 | DMA_CCR_EN;
+
+    DMA1_Channel7->CMAR = (uint32_t)&cs_high_word;
+    DMA1_Channel7->CNDTR = len;
+    DMA1_Channel7->CCR = DMA_CCR_DIR | DMA_CCR_PL_1 | DMA_CCR_MSIZE_1 | DMA_CCR_PSIZE_1 | DMA_CCR_TCIE | DMA_CCR_EN;
+
+    /* first tick overflows the counter so the sequence starts with CS low */
+    TIM2->CNT = TIM2->ARR;
+    TIM2->SR = 0;
+    TIM2->DIER = TIM_DIER_UDE | TIM_DIER_CC3DE | TIM_DIER_CC2DE;
+    TIM2->CR1 = TIM_CR1_CEN;
+#endif
+
+    return 0;
+}
+
+/******************************************************************************
+function :	start sending a buffer with DMA
+parameter:
+    pData : Write data, must stay valid until the transfer is over
+    Len   : data length, 1 to EPAPER_TRANSFER_MAX
+    done  : completion callback (IRQ context), may be NULL
+return   :  0 started, -1 busy or bad length
+******************************************************************************/
+int EPAPER_Send_nData_DMA(const uint8_t *pData, uint32_t Len, EPAPER_Transfer_Callback done)
+{
+    return EPAPER_Transfer_Start(pData, Len, 1, done);
+}
+
+/******************************************************************************
+function :	start sending the same byte Len times with DMA
+parameter:
+    Data : Write data
+    Len  : data length, 1 to EPAPER_TRANSFER_MAX
+    done : completion callback (IRQ context), may be NULL
+return   :  0 started, -1 busy or bad length
+******************************************************************************/
+int EPAPER_Send_Fill_DMA(uint8_t Data, uint32_t Len, EPAPER_Transfer_Callback done)
+{
+    if (transfer_busy)
+        return -1;
+
+    transfer_fill = Data;
+    return EPAPER_Transfer_Start(&transfer_fill, Len, 0, done);
+}
+
+uint8_t EPAPER_Transfer_Busy(void)
+{
+    return transfer_busy;
+}
+
+/******************************************************************************
+function :	sleep until the current transfer is over
+parameter:
+return   :  0 done, -1 timeout (the transfer is aborted)
+******************************************************************************/
+int EPAPER_Transfer_Wait(void)
+{
+    uint32_t start = HAL_GetTick();
+
+    while (transfer_busy)
+    {
+        if ((HAL_GetTick() - start) > EPAPER_TRANSFER_TIMEOUT)
+        {
+            transfer_done = NULL;
+            EPAPER_Transfer_IRQHandler();
+            return -1;
+        }
+        ENERGY_SLEEP();
+    }
+    return 0;
+}
+
+/******************************************************************************
+function :	end of transfer, call from the DMA IRQ handler
+            (DMA1_Channel2_3 on F0, DMA1_Channel7 on F1)
+parameter:
+******************************************************************************/
+void EPAPER_Transfer_IRQHandler(void)
+{
+#if defined(SPI_CR2_NSSP)
+    DMA1->IFCR = DMA_IFCR_CGIF3;
+    DMA1_Channel3->CCR = 0;
+
+    /* let the last byte leave the shift register before taking PA4 back */
+    while ((SPI1->SR & SPI_SR_FTLVL) || (SPI1->SR & SPI_SR_BSY));
+    CLEAR_BIT(SPI1->CR2, SPI_CR2_TXDMAEN);
+    MODIFY_REG(EPAPER_CS_PORT->MODER, 3U << (2 * EPAPER_CS_PIN_NUM), 1U << (2 * EPAPER_CS_PIN_NUM)); // output
+
+    /* nothing is read back, drop what the RX FIFO collected */
+    while (SPI1->SR & SPI_SR_FRLVL)
+        (void)*(__IO uint8_t *)&SPI1->DR;
+    (void)SPI1->SR;
+#else
+    DMA1->IFCR = DMA_IFCR_CGIF7;
+    TIM2->CR1 = 0;
+    TIM2->DIER = 0;
+    DMA1_Channel1->CCR = 0;
+    DMA1_Channel2->CCR = 0;
+    DMA1_Channel7->CCR = 0;
+
+    Port_Pin_Write(EPAPER_CS_PORT, EPAPER_CS_PIN, 1);
+    (void)SPI1->DR;
+    (void)SPI1->SR;
+#endif
+
+    transfer_busy = 0;
+
+    if (transfer_done)
+    {
+        EPAPER_Transfer_Callback done = transfer_done;
+        transfer_done = NULL;
+        done();
+    }
+}
+
+/******************************************************************************
+function :	Read Busy
+parameter:
+
+Sleeps until the controller releases BUSY. Waits for the operation armed by
+EPAPER_Busy_Start, or for the current BUSY level when nothing is armed.
+******************************************************************************/
+void EPAPER_ReadBusy(void)
+{
+    if (!busy_active)
+        EPAPER_Busy_Start(NULL);
+
+    while (EPAPER_Busy())
+    {
+        if ((HAL_GetTick() - busy_start) > EPAPER_BUSY_TIMEOUT)
+        {
+            busy_active = 0;
+            busy_done = NULL;
+            return;
+        }
+        ENERGY_SLEEP();
+    }
+}
+
+/******************************************************************************
+function :	route the BUSY pin to its EXTI line, call once after MX_GPIO_Init
+parameter:
+******************************************************************************/
+void EPAPER_Busy_Init(void)
+{
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+    GPIO_InitStruct.Pin = EPAPER_BUSY_PIN;
+    GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
+    GPIO_InitStruct.Pull = GPIO_NOPULL;
+    HAL_GPIO_Init(EPAPER_BUSY_PORT, &GPIO_InitStruct);
+
+    HAL_NVIC_SetPriority(EPAPER_BUSY_IRQn, 2, 0);
+    HAL_NVIC_EnableIRQ(EPAPER_BUSY_IRQn);
+}
+
+static void EPAPER_Busy_End(void)
+{
+    busy_time = HAL_GetTick() - busy_start;
+    busy_total += busy_time;
+    busy_active = 0;
+    EPAPER_TRACE_BUSY(busy_time);
+    ENERGY_ADD_MS(ENERGY_PANEL, busy_time);
+
+    if (busy_done)
+    {
+        EPAPER_Transfer_Callback done = busy_done;
+        busy_done = NULL;
+        done();
+    }
+}
+
+/******************************************************************************
+function :	arm the end of busy detection
+parameter:
+    done : called from the EXTI IRQ when BUSY goes high, may be NULL
+
+Call just before the command byte that starts the operation so its rising
+edge cannot be missed.
+******************************************************************************/
+void EPAPER_Busy_Start(EPAPER_Transfer_Callback done)
+{
+    busy_done = done;
+    busy_start = HAL_GetTick();
+    __HAL_GPIO_EXTI_CLEAR_IT(EPAPER_BUSY_PIN);
+    busy_active = 1;
+}
+
+/******************************************************************************
+function :	non blocking busy check
+parameter:
+return   :  1 while the controller is busy
+
+Also ends the operation on the pin level once the guard time is over, in case
+BUSY was never asserted (edge missed or command without busy phase).
+******************************************************************************/
+uint8_t EPAPER_Busy(void)
+{
+    if (busy_active && Port_Pin_Read(EPAPER_BUSY_PORT, EPAPER_BUSY_PIN) &&
+        (HAL_GetTick() - busy_start) >= EPAPER_BUSY_GUARD)
+    {
+        __disable_irq();
+        if (busy_active)
+            EPAPER_Busy_End();
+        __enable_irq();
+    }
+    return busy_active;
+}
+
+uint32_t EPAPER_Busy_Time(void)
+{
+    return busy_time;
+}
+
+uint32_t EPAPER_Busy_Total(void)
+{
+    return busy_total;
+}
+
+/******************************************************************************
+function :	BUSY rising edge, call from the EXTI IRQ handler
+            (EXTI0 on F1, EXTI0_1 on F0)
+parameter:
+******************************************************************************/
+void EPAPER_Busy_IRQHandler(void)
+{
+    if (__HAL_GPIO_EXTI_GET_IT(EPAPER_BUSY_PIN) != 0)
+    {
+        __HAL_GPIO_EXTI_CLEAR_IT(EPAPER_BUSY_PIN);
+        if (busy_active)
+            EPAPER_Busy_End();
+    }
+}
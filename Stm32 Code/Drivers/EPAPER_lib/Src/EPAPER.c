@@ -0,0 +1,1824 @@
+
+
+#include "EPAPER.h"
+#include "DRIVER.h"
+#include "EPAPER_LUT.h"
+#include "EPAPER_Ghost.h"
+#include "EPAPER_Trace.h"
+#include "EPAPER_Widget.h"
+#include "pixel_font.h"
+#include "EPAPER_Glyph.h"
+#include "pixel_assets.h"
+#include "probe.h"
+#include "scratch.h"
+#include <stdlib.h>
+#include <string.h>
+
+unsigned char EPAPER_Flag = 0;
+
+/* Frame buffer, same layout as the controller RAM (1 = white in KW mode) */
+static uint8_t EPAPER_Frame[EPAPER_BUFFER_SIZE];
+
+/* Regions of the frame buffer not yet pushed to the panel */
+static EPAPER_Rect EPAPER_Dirty[EPAPER_DIRTY_MAX];
+static uint16_t EPAPER_Dirty_Tags[EPAPER_DIRTY_MAX];    // drawing calls, for EPAPER_Trace
+static uint8_t EPAPER_Dirty_Count = 0;
+
+/* Regions sent by the last flush, their old data plane still holds the image
+   before that refresh and is brought up to date by the next flush */
+static EPAPER_Rect EPAPER_Stale[EPAPER_DIRTY_MAX];
+static uint16_t EPAPER_Stale_Tags[EPAPER_DIRTY_MAX];
+static uint8_t EPAPER_Stale_Count = 0;
+
+/* Image on the panel where the frame buffer changed since the last flush:
+   8x8 pixel tiles saved on their first write. Tiles that did not fit are
+   only flagged and sent with an inverted old plane so every pixel is driven */
+static uint8_t EPAPER_Journal_Data[EPAPER_JOURNAL_TILES][8];
+static uint16_t EPAPER_Journal_Tile[EPAPER_JOURNAL_TILES];
+static uint8_t EPAPER_Journal_Count = 0;
+static uint8_t EPAPER_Touched[(EPAPER_TILES + 7) / 8];
+
+/* Panel black after EPAPER_Clear, whatever the frame buffer holds */
+static uint8_t EPAPER_Panel_Cleared = 0;
+
+/* Red layer of the (B) panel. It has no frame buffer of its own: the layer
+   is drawn again for each band of EPAPER_RED_BAND lines while the red plane
+   is sent, the drawing functions then write to the band instead */
+static EPAPER_Draw_Callback EPAPER_Red_Draw = NULL;
+static uint8_t EPAPER_Red_Dirty = 0;
+static uint8_t *EPAPER_Band = NULL;
+static uint16_t EPAPER_Band_Start = 0;
+
+/* Icon drawn by the last EPAPER_Print_Moon_Phase, erased by the next one */
+static const EPAPER_Bitmap *EPAPER_Sky_Icon = NULL;
+static uint16_t EPAPER_Sky_X = 0;
+static uint16_t EPAPER_Sky_Y = 0;
+
+/* Partial mode still on, left once the refresh is over */
+static uint8_t EPAPER_Partial_Active = 0;
+
+/* Waveform selection, the registers are only rewritten when it changes */
+#define EPAPER_LUT_NONE 0xFF
+static uint8_t EPAPER_LUT_Registers = 0;              // panel setting uses the register LUT
+static uint8_t EPAPER_LUT_Loaded = EPAPER_LUT_NONE;    // (band << 4) | mode in the registers
+static EPAPER_LUT_Mode EPAPER_LUT_Next = EPAPER_LUT_PARTIAL;
+static uint8_t EPAPER_LUT_Band_Index = 2;              // 15 to 30 °C until the first reading
+
+static inline void EPAPER_Rect_Union(EPAPER_Rect *dst, const EPAPER_Rect *src)
+{
+	if (src->x_start < dst->x_start) dst->x_start = src->x_start;
+	if (src->y_start < dst->y_start) dst->y_start = src->y_start;
+	if (src->x_end > dst->x_end) dst->x_end = src->x_end;
+	if (src->y_end > dst->y_end) dst->y_end = src->y_end;
+}
+
+static inline uint32_t EPAPER_Rect_Area(const EPAPER_Rect *r)
+{
+	return (uint32_t)(r->x_end - r->x_start + 1) * (r->y_end - r->y_start + 1);
+}
+
+/******************************************************************************
+function :	Initialize the e-Paper register
+parameter:
+******************************************************************************/
+void EPAPER_Init(void)
+{
+    EPAPER_Refresh_Wait();
+    EPAPER_TRACE_SECTION(EPAPER_SECTION_INIT, 0);
+    EPAPER_Reset();
+
+    EPAPER_SendCommand(0x61);
+    EPAPER_SendData(0xF0);
+    EPAPER_SendData(0x01);
+    EPAPER_SendData(0x68);
+
+    EPAPER_SendCommand(0x06);
+    EPAPER_SendData(0x17);
+    EPAPER_SendData(0x17);
+    EPAPER_SendData(0x17);
+
+    EPAPER_SendCommand(0x00);
+    EPAPER_SendData(0x0F);
+    EPAPER_SendData(0x0D);
+    EPAPER_LUT_Registers = 0;
+    EPAPER_LUT_Loaded = EPAPER_LUT_NONE;
+
+    EPAPER_Busy_Start(NULL);
+    EPAPER_SendCommand(0x04); // POWER ON
+    EPAPER_ReadBusy();
+}
+
+
+void EPAPER_Part_Init(void)
+{
+    EPAPER_Refresh_Wait();
+    EPAPER_TRACE_SECTION(EPAPER_SECTION_INIT, 0);
+    EPAPER_Reset();
+
+    EPAPER_Busy_Start(NULL);
+    EPAPER_SendCommand(0x04); // POWER ON
+    EPAPER_ReadBusy();
+
+    EPAPER_SendCommand(0x00);
+    EPAPER_SendData(0x3F);
+    EPAPER_SendData(0x0D);
+
+    EPAPER_SendCommand(0x61);
+    EPAPER_SendData(0xF0);
+    EPAPER_SendData(0x01);
+    EPAPER_SendData(0x68);
+
+
+    EPAPER_SendCommand(0x50);
+    EPAPER_SendData(0xF7);
+
+    EPAPER_SendCommand(0xE3);
+    EPAPER_SendData(0x88);
+
+    /* the reset wiped the registers, the LUT is sent with the next refresh */
+    EPAPER_LUT_Registers = 1;
+    EPAPER_LUT_Loaded = EPAPER_LUT_NONE;
+}
+
+/******************************************************************************
+function :	start a display refresh and return
+parameter:
+    done: called from the BUSY IRQ when the refresh is over, may be NULL
+
+The measured duration is available from EPAPER_Busy_Time() afterwards.
+******************************************************************************/
+void EPAPER_Refresh_Start(EPAPER_Transfer_Callback done)
+{
+    EPAPER_lut();
+    EPAPER_LUT_Next = EPAPER_LUT_PARTIAL;
+
+    EPAPER_SendCommand(0x17);
+    EPAPER_Busy_Start(done);
+    EPAPER_SendData(0xA5);
+}
+
+/******************************************************************************
+function :	non blocking refresh state
+parameter:
+return   :  1 while the panel is refreshing
+
+Leaves partial mode once the refresh is over, call it from the main loop.
+******************************************************************************/
+uint8_t EPAPER_Refresh_Poll(void)
+{
+    if (EPAPER_Busy())
+        return 1;
+
+    if (EPAPER_Partial_Active)
+    {
+        EPAPER_Partial_Active = 0;
+        EPAPER_SendCommand(0x92); // partial mode off cmd
+    }
+    return 0;
+}
+
+/******************************************************************************
+function :	sleep until the running refresh is over
+parameter:
+******************************************************************************/
+void EPAPER_Refresh_Wait(void)
+{
+    if (EPAPER_Busy())
+        EPAPER_ReadBusy();
+    EPAPER_Refresh_Poll();
+}
+
+void EPAPER_refresh(void)
+{
+    EPAPER_Refresh_Start(NULL);
+    EPAPER_Refresh_Wait();
+}
+
+/******************************************************************************
+function :	add a region to the dirty table
+parameter:
+    r: region, inside the panel
+    tags: drawing calls it comes from, for EPAPER_Trace
+
+Overlapping or touching regions are merged. When the table is full the two
+regions whose union grows the least are merged to make room.
+******************************************************************************/
+static void EPAPER_FB_Mark_Rect(EPAPER_Rect r, uint16_t tags)
+{
+	uint8_t merged = 1;
+	while (merged)
+	{
+		merged = 0;
+		for (uint8_t i = 0; i < EPAPER_Dirty_Count; i++)
+		{
+			EPAPER_Rect *d = &EPAPER_Dirty[i];
+			if (r.x_start > d->x_end + 1 || d->x_start > r.x_end + 1 ||
+				r.y_start > d->y_end + 1 || d->y_start > r.y_end + 1)
+				continue;
+
+			EPAPER_Rect_Union(&r, d);
+			tags |= EPAPER_Dirty_Tags[i];
+			EPAPER_Dirty_Count--;
+			EPAPER_Dirty[i] = EPAPER_Dirty[EPAPER_Dirty_Count];
+			EPAPER_Dirty_Tags[i] = EPAPER_Dirty_Tags[EPAPER_Dirty_Count];
+			merged = 1;
+			break;
+		}
+	}
+
+	if (EPAPER_Dirty_Count == EPAPER_DIRTY_MAX)
+	{
+		/* table full : fold r into the region it costs the least to grow */
+		uint32_t best_cost = UINT32_MAX;
+		uint8_t best = 0;
+		for (uint8_t i = 0; i < EPAPER_Dirty_Count; i++)
+		{
+			EPAPER_Rect u = EPAPER_Dirty[i];
+			EPAPER_Rect_Union(&u, &r);
+			uint32_t cost = EPAPER_Rect_Area(&u) - EPAPER_Rect_Area(&EPAPER_Dirty[i]);
+			if (cost < best_cost)
+			{
+				best_cost = cost;
+				best = i;
+			}
+		}
+		EPAPER_Rect_Union(&r, &EPAPER_Dirty[best]);
+		tags |= EPAPER_Dirty_Tags[best];
+		EPAPER_Dirty_Count--;
+		EPAPER_Dirty[best] = EPAPER_Dirty[EPAPER_Dirty_Count];
+		EPAPER_Dirty_Tags[best] = EPAPER_Dirty_Tags[EPAPER_Dirty_Count];
+		EPAPER_FB_Mark_Rect(r, tags);
+		return;
+	}
+
+	EPAPER_Dirty[EPAPER_Dirty_Count] = r;
+	EPAPER_Dirty_Tags[EPAPER_Dirty_Count] = tags;
+	EPAPER_Dirty_Count++;
+}
+
+/******************************************************************************
+function :	mark a region of the frame buffer as changed
+parameter:
+    x_start: start x point
+    y_start: start y point
+    width: width
+    height: height
+******************************************************************************/
+static void EPAPER_FB_Mark(uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height)
+{
+	if (width == 0 || height == 0 || x_start >= EPAPER_WIDTH || y_start >= EPAPER_HEIGHT)
+		return;
+
+	EPAPER_Rect r;
+	r.x_start = x_start;
+	r.y_start = y_start;
+	r.x_end = (x_start + width > EPAPER_WIDTH) ? EPAPER_WIDTH - 1 : x_start + width - 1;
+	r.y_end = (y_start + height > EPAPER_HEIGHT) ? EPAPER_HEIGHT - 1 : y_start + height - 1;
+	EPAPER_FB_Mark_Rect(r, EPAPER_TRACE_TAGS());
+}
+
+/******************************************************************************
+function :	write a frame buffer byte, saving its tile for the old data plane
+parameter:
+    offset: byte in the frame buffer
+    value: new value
+
+The tile is saved the first time one of its bytes really changes, redrawing
+the same content costs no journal entry.
+******************************************************************************/
+static inline void EPAPER_FB_Write(uint16_t offset, uint8_t value)
+{
+	if (EPAPER_Frame[offset] == value)
+		return;
+
+	uint16_t line = offset / EPAPER_BYTE_WIDTH;
+	uint16_t col = offset - line * EPAPER_BYTE_WIDTH;
+	uint16_t tile = (line >> 3) * EPAPER_BYTE_WIDTH + col;
+
+	if (!(EPAPER_Touched[tile >> 3] & (1 << (tile & 7))))
+	{
+		EPAPER_Touched[tile >> 3] |= 1 << (tile & 7);
+		if (EPAPER_Journal_Count < EPAPER_JOURNAL_TILES)
+		{
+			const uint8_t *src = &EPAPER_Frame[(line & ~7u) * EPAPER_BYTE_WIDTH + col];
+			uint8_t *save = EPAPER_Journal_Data[EPAPER_Journal_Count];
+			for (uint8_t k = 0; k < 8; k++)
+				save[k] = src[k * EPAPER_BYTE_WIDTH];
+			EPAPER_Journal_Tile[EPAPER_Journal_Count++] = tile;
+		}
+	}
+	EPAPER_Frame[offset] = value;
+}
+
+/******************************************************************************
+function :	the frame buffer becomes the image on the panel
+parameter:
+******************************************************************************/
+static void EPAPER_Journal_Commit(void)
+{
+	memset(EPAPER_Touched, 0, sizeof(EPAPER_Touched));
+	EPAPER_Journal_Count = 0;
+	EPAPER_Panel_Cleared = 0;
+}
+
+/******************************************************************************
+function :	send a region with an inverted old plane on the next flush
+parameter:
+    r: region, panel coordinates
+
+Its tiles are flagged and their journal entries dropped, as for tiles that
+did not fit in the journal: every pixel then goes through the bw or wb
+waveform and is cycled, even where the image does not change.
+******************************************************************************/
+static void EPAPER_Journal_Invert(const EPAPER_Rect *r)
+{
+	uint16_t first_col = r->x_start >> 3;
+	uint16_t last_col = r->x_end >> 3;
+	uint16_t first_row = r->y_start >> 3;
+	uint16_t last_row = r->y_end >> 3;
+
+	for (uint16_t row = first_row; row <= last_row; row++)
+	{
+		for (uint16_t col = first_col; col <= last_col; col++)
+		{
+			uint16_t tile = row * EPAPER_BYTE_WIDTH + col;
+			EPAPER_Touched[tile >> 3] |= 1 << (tile & 7);
+		}
+	}
+
+	for (uint8_t n = 0; n < EPAPER_Journal_Count; n++)
+	{
+		uint16_t tile = EPAPER_Journal_Tile[n];
+		uint16_t row = tile / EPAPER_BYTE_WIDTH;
+		uint16_t col = tile % EPAPER_BYTE_WIDTH;
+		if (row >= first_row && row <= last_row && col >= first_col && col <= last_col)
+			EPAPER_Journal_Tile[n] = EPAPER_TILES;    // matches no tile
+	}
+}
+
+/******************************************************************************
+function :	send the image on the panel as the old data plane (0x10)
+parameter:
+    r: region, the window must already be set
+
+The frame buffer is sent where it did not change since the last flush, the
+journal elsewhere.
+******************************************************************************/
+static void EPAPER_Send_Old(const EPAPER_Rect *r)
+{
+	uint16_t first_byte = r->x_start >> 3;
+	uint16_t last_byte = r->x_end >> 3;
+	uint8_t slot[EPAPER_BYTE_WIDTH];   // journal entry per column, 0xFF unchanged, 0xFE lost
+	uint8_t line[EPAPER_BYTE_WIDTH];
+
+	EPAPER_SendCommand(0x10);
+	for (uint16_t j = r->y_start; j <= r->y_end; j++)
+	{
+		const uint8_t *frame = &EPAPER_Frame[j * EPAPER_BYTE_WIDTH];
+
+		if (j == r->y_start || (j & 7) == 0)
+		{
+			uint16_t row = j >> 3;
+			for (uint16_t col = first_byte; col <= last_byte; col++)
+			{
+				uint16_t tile = row * EPAPER_BYTE_WIDTH + col;
+				slot[col] = (EPAPER_Touched[tile >> 3] & (1 << (tile & 7))) ? 0xFE : 0xFF;
+			}
+			for (uint8_t n = 0; n < EPAPER_Journal_Count; n++)
+			{
+				uint16_t tile = EPAPER_Journal_Tile[n];
+				uint16_t col = tile % EPAPER_BYTE_WIDTH;
+				if (tile / EPAPER_BYTE_WIDTH == row && col >= first_byte && col <= last_byte)
+					slot[col] = n;
+			}
+		}
+
+		for (uint16_t col = first_byte; col <= last_byte; col++)
+		{
+			if (EPAPER_Panel_Cleared)
+				line[col] = 0x00;
+			else if (slot[col] == 0xFF)
+				line[col] = frame[col];
+			else if (slot[col] == 0xFE)
+				line[col] = ~frame[col];
+			else
+				line[col] = EPAPER_Journal_Data[slot[col]][j & 7];
+		}
+		EPAPER_Send_nData(&line[first_byte], last_byte - first_byte + 1);
+	}
+}
+
+/******************************************************************************
+function :	copy the part of an image inside the red band
+parameter:
+    same as EPAPER_FB_Blit
+******************************************************************************/
+static void EPAPER_Band_Blit(const uint8_t *image, uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height)
+{
+	uint16_t byte_width = (width + 7) / 8;
+	uint8_t shift = x_start & 0x07;
+	uint16_t first_byte = x_start >> 3;
+	uint16_t j_start = (y_start < EPAPER_Band_Start) ? EPAPER_Band_Start - y_start : 0;
+
+	for (uint16_t j = j_start; j < height && (y_start + j) < EPAPER_Band_Start + EPAPER_RED_BAND; j++)
+	{
+		uint8_t *dst = &EPAPER_Band[(y_start + j - EPAPER_Band_Start) * EPAPER_BYTE_WIDTH + first_byte];
+		const uint8_t *src = &image[j * byte_width];
+
+		for (uint16_t i = 0; i < byte_width && (first_byte + i) < EPAPER_BYTE_WIDTH; i++)
+		{
+			uint16_t remaining = width - 8 * i;
+			uint8_t mask = remaining >= 8 ? 0xFF : (uint8_t)(0xFF << (8 - remaining));
+			uint8_t data = src[i] & mask;
+
+			dst[i] = (dst[i] & ~(mask >> shift)) | (data >> shift);
+			if (shift && (first_byte + i + 1) < EPAPER_BYTE_WIDTH)
+			{
+				dst[i + 1] = (dst[i + 1] & (uint8_t)~(mask << (8 - shift))) | (uint8_t)(data << (8 - shift));
+			}
+		}
+	}
+}
+
+/******************************************************************************
+function :	copy an image into the frame buffer
+parameter:
+    image: Image data, (width+7)/8 bytes per line
+    x_start: start x point, any pixel position
+    y_start: start y point
+    width: width in pixel
+    height: height in pixel
+
+Only the pixels covered by the image are written, pixels sharing a byte with
+the image border keep their value.
+******************************************************************************/
+void EPAPER_FB_Blit(const uint8_t *image, uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height)
+{
+	if (width == 0 || height == 0 || x_start >= EPAPER_WIDTH || y_start >= EPAPER_HEIGHT)
+		return;
+
+	uint16_t byte_width = (width + 7) / 8;
+	uint8_t shift = x_start & 0x07;
+	uint16_t first_byte = x_start >> 3;
+
+	if (EPAPER_Band != NULL)
+	{
+		EPAPER_Band_Blit(image, x_start, y_start, width, height);
+		return;
+	}
+
+	for (uint16_t j = 0; j < height && (y_start + j) < EPAPER_HEIGHT; j++)
+	{
+		uint16_t offset = (y_start + j) * EPAPER_BYTE_WIDTH + first_byte;
+		const uint8_t *dst = &EPAPER_Frame[offset];
+		const uint8_t *src = &image[j * byte_width];
+
+		for (uint16_t i = 0; i < byte_width && (first_byte + i) < EPAPER_BYTE_WIDTH; i++)
+		{
+			uint16_t remaining = width - 8 * i;
+			uint8_t mask = remaining >= 8 ? 0xFF : (uint8_t)(0xFF << (8 - remaining));
+			uint8_t data = src[i] & mask;
+
+			EPAPER_FB_Write(offset + i, (dst[i] & ~(mask >> shift)) | (data >> shift));
+			if (shift && (first_byte + i + 1) < EPAPER_BYTE_WIDTH)
+			{
+				EPAPER_FB_Write(offset + i + 1, (dst[i + 1] & (uint8_t)~(mask << (8 - shift))) | (uint8_t)(data << (8 - shift)));
+			}
+		}
+	}
+
+	EPAPER_FB_Mark(x_start, y_start, width, height);
+}
+
+/******************************************************************************
+function :	fill a region of the frame buffer
+parameter:
+    x_start: start x point
+    y_start: start y point
+    width: width in pixel
+    height: height in pixel
+    color: 0xFF for white, 0x00 for black (KW data)
+******************************************************************************/
+void EPAPER_FB_Fill(uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height, uint8_t color)
+{
+	uint8_t line[EPAPER_BYTE_WIDTH];
+	memset(line, color, sizeof(line));
+
+	for (uint16_t j = 0; j < height; j++)
+	{
+		EPAPER_FB_Blit(line, x_start, y_start + j, width, 1);
+	}
+}
+
+/******************************************************************************
+function :	mirror the bits of a byte
+parameter:
+******************************************************************************/
+static inline uint8_t EPAPER_Reverse8(uint8_t b)
+{
+	b = (uint8_t)((b >> 4) | (b << 4));
+	b = (uint8_t)(((b & 0xCC) >> 2) | ((b & 0x33) << 2));
+	b = (uint8_t)(((b & 0xAA) >> 1) | ((b & 0x55) << 1));
+	return b;
+}
+
+/******************************************************************************
+function :	transpose an 8x8 bit matrix in place
+parameter:
+    tile: 8 lines of 8 pixels, MSB first
+
+After the call bit 7-i of tile[k] holds what was bit 7-k of tile[i]. Three
+rounds of masked swaps on two 32 bit words, no loop over the pixels.
+******************************************************************************/
+static void EPAPER_Transpose8(uint8_t *tile)
+{
+	uint32_t x = ((uint32_t)tile[0] << 24) | ((uint32_t)tile[1] << 16) | ((uint32_t)tile[2] << 8) | tile[3];
+	uint32_t y = ((uint32_t)tile[4] << 24) | ((uint32_t)tile[5] << 16) | ((uint32_t)tile[6] << 8) | tile[7];
+	uint32_t t;
+
+	t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+	t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+
+	t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+	t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+
+	t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+	y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+	x = t;
+
+	tile[0] = x >> 24; tile[1] = x >> 16; tile[2] = x >> 8; tile[3] = x;
+	tile[4] = y >> 24; tile[5] = y >> 16; tile[6] = y >> 8; tile[7] = y;
+}
+
+/******************************************************************************
+function :	copy a rotated image into the frame buffer
+parameter:
+    image: Image data, (width+7)/8 bytes per line
+    width: image width in pixel
+    height: image height in pixel
+    x_start: start x point of the rotated image
+    y_start: start y point of the rotated image
+    rotation: clockwise rotation applied to the image
+
+For 90 and 270 the image is cut in 8x8 tiles that are transposed and written
+8 lines at a time, the rotated image is height pixels wide.
+******************************************************************************/
+void EPAPER_FB_Blit_Rotate(const uint8_t *image, uint16_t width, uint16_t height, uint16_t x_start, uint16_t y_start, EPAPER_Rotation rotation)
+{
+	uint16_t byte_width = (width + 7) / 8;
+
+	if (width == 0 || height == 0)
+		return;
+
+	if (rotation == EPAPER_ROTATE_0)
+	{
+		EPAPER_FB_Blit(image, x_start, y_start, width, height);
+	}
+	else if (rotation == EPAPER_ROTATE_180)
+	{
+		uint8_t line[EPAPER_BYTE_WIDTH + 1];
+		uint8_t pad = 8 * byte_width - width;
+
+		if (byte_width > EPAPER_BYTE_WIDTH)
+			return;
+
+		for (uint16_t j = 0; j < height; j++)
+		{
+			const uint8_t *src = &image[(height - 1 - j) * byte_width];
+			for (uint16_t i = 0; i < byte_width; i++)
+			{
+				line[i] = EPAPER_Reverse8(src[byte_width - 1 - i]);
+			}
+			if (pad)
+			{
+				line[byte_width] = 0xFF;
+				for (uint16_t i = 0; i < byte_width; i++)
+				{
+					line[i] = (uint8_t)((line[i] << pad) | (line[i + 1] >> (8 - pad)));
+				}
+			}
+			EPAPER_FB_Blit(line, x_start, y_start + j, width, 1);
+		}
+	}
+	else
+	{
+		size_t mark = Scratch_Mark();
+		uint8_t *band = Scratch_Alloc(8 * EPAPER_BYTE_WIDTH);
+		uint8_t tile[8];
+		uint16_t band_width = (height + 7) / 8;
+
+		if (band == NULL || band_width > EPAPER_BYTE_WIDTH)
+		{
+			Scratch_Release(mark);
+			return;
+		}
+
+		for (uint16_t c = 0; c < byte_width; c++)
+		{
+			uint8_t lines = (width - 8 * c < 8) ? width - 8 * c : 8;
+
+			for (uint16_t b = 0; b < band_width; b++)
+			{
+				for (uint8_t i = 0; i < 8; i++)
+				{
+					// 90 reads the source from the bottom up, 270 from the top down
+					int16_t row = (rotation == EPAPER_ROTATE_90) ? (int16_t)(height - 1 - 8 * b - i) : (int16_t)(8 * b + i);
+					tile[i] = (row >= 0 && row < height) ? image[row * byte_width + c] : 0xFF;
+				}
+
+				EPAPER_Transpose8(tile);
+
+				for (uint8_t k = 0; k < lines; k++)
+				{
+					uint8_t line = (rotation == EPAPER_ROTATE_90) ? k : lines - 1 - k;
+					band[line * band_width + b] = tile[k];
+				}
+			}
+
+			if (rotation == EPAPER_ROTATE_90)
+				EPAPER_FB_Blit(band, x_start, y_start + 8 * c, height, lines);
+			else
+				EPAPER_FB_Blit(band, x_start, y_start + width - 8 * c - lines, height, lines);
+		}
+		Scratch_Release(mark);
+	}
+}
+
+/******************************************************************************
+function :	panel region of a screen rectangle
+parameter:
+    x: left on screen
+    y: top on screen
+    w: width on screen
+    h: height on screen
+    rect: panel region, end points inclusive
+return   :  0, -1 if the rectangle starts off the panel
+******************************************************************************/
+static int EPAPER_Screen_Rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, EPAPER_Rect *rect)
+{
+	int32_t x_start, y_start;
+	uint16_t pw = (EPAPER_ROTATION & 1) ? h : w;    // size on the panel
+	uint16_t ph = (EPAPER_ROTATION & 1) ? w : h;
+
+	switch (EPAPER_ROTATION)
+	{
+		case EPAPER_ROTATE_90:
+			x_start = (int32_t)EPAPER_WIDTH - y - h;
+			y_start = x;
+			break;
+		case EPAPER_ROTATE_180:
+			x_start = (int32_t)EPAPER_WIDTH - x - w;
+			y_start = (int32_t)EPAPER_HEIGHT - y - h;
+			break;
+		case EPAPER_ROTATE_270:
+			x_start = y;
+			y_start = (int32_t)EPAPER_HEIGHT - x - w;
+			break;
+		default:
+			x_start = x;
+			y_start = y;
+			break;
+	}
+
+	if (x_start < 0 || y_start < 0)
+		return -1;
+
+	rect->x_start = x_start;
+	rect->y_start = y_start;
+	rect->x_end = x_start + pw - 1;
+	rect->y_end = y_start + ph - 1;
+	return 0;
+}
+
+/******************************************************************************
+function :	draw an image at screen coordinates
+parameter:
+    image: Image data, (width+7)/8 bytes per line
+    width: width of the stored image in pixel
+    height: height of the stored image in pixel
+    stored: clockwise rotation already applied to the stored image,
+            EPAPER_FONT_ROTATION for pixel_font.c and pixel_assets.c data
+    x: left of the image on screen
+    y: top of the image on screen
+
+The screen is the panel turned by EPAPER_ROTATION, the image gets the
+rotation it still misses before reaching the frame buffer.
+******************************************************************************/
+void EPAPER_Draw_Image(const uint8_t *image, uint16_t width, uint16_t height, EPAPER_Rotation stored, uint16_t x, uint16_t y)
+{
+	uint16_t w = (stored & 1) ? height : width;    // size on screen
+	uint16_t h = (stored & 1) ? width : height;
+	EPAPER_Rect rect;
+
+	if (EPAPER_Screen_Rect(x, y, w, h, &rect) != 0)
+		return;
+
+	EPAPER_FB_Blit_Rotate(image, width, height, rect.x_start, rect.y_start, (EPAPER_Rotation)((EPAPER_ROTATION - stored) & 3));
+}
+
+/******************************************************************************
+function :	fill a rectangle at screen coordinates
+parameter:
+    x: left on screen
+    y: top on screen
+    width: width on screen
+    height: height on screen
+    color: 0xFF for white, 0x00 for black (red inside EPAPER_Red_Layer)
+******************************************************************************/
+void EPAPER_Draw_Rect(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t color)
+{
+	EPAPER_Rect rect;
+
+	if (width == 0 || height == 0 || EPAPER_Screen_Rect(x, y, width, height, &rect) != 0)
+		return;
+
+	EPAPER_FB_Fill(rect.x_start, rect.y_start, rect.x_end - rect.x_start + 1, rect.y_end - rect.y_start + 1, color);
+}
+
+/******************************************************************************
+function :	set the controller partial window
+parameter:
+    rect: window, x is rounded to the enclosing bytes
+******************************************************************************/
+static void EPAPER_Set_Window(const EPAPER_Rect *rect)
+{
+	EPAPER_SendCommand(0x90); // partial window cmd
+	EPAPER_SendData(rect->x_start & 0xF8);           // colonne de départ
+	EPAPER_SendData((rect->x_end & 0xF8) | 0x07);    // colonne de fin
+	EPAPER_SendData(rect->y_start >> 8);             // Ligne de départ
+	EPAPER_SendData(rect->y_start & 0xFF);
+	EPAPER_SendData(rect->y_end >> 8);               // Ligne de fin
+	EPAPER_SendData(rect->y_end & 0xFF);
+	EPAPER_SendData(0x01);                           // pt_scan
+}
+
+/******************************************************************************
+function :	push every changed region of the frame buffer and start one refresh
+parameter:
+    done: called from the BUSY IRQ when the refresh is over, may be NULL
+return   :  1 if a refresh was started, 0 if nothing changed
+
+Each dirty region is written to the controller RAM through its own partial
+window, then a single refresh is run on the window enclosing all of them.
+Drawing may go on during the refresh, the next panel access waits for it.
+
+Both planes are sent, old (0x10) with the image on the panel and new (0x13)
+with the frame buffer, so unchanged pixels get the ww / bb waveforms. The
+regions of the previous flush get their old plane updated first, else the
+enclosing window would drive them again.
+******************************************************************************/
+uint8_t EPAPER_Flush_Start(EPAPER_Transfer_Callback done)
+{
+	if (EPAPER_Dirty_Count == 0)
+		return 0;
+
+	EPAPER_Refresh_Wait();
+
+	EPAPER_Rect bounds = EPAPER_Dirty[0];
+	uint16_t tags = 0;
+
+	EPAPER_TRACE_UPDATE();
+	EPAPER_SendCommand(0x91); // partial mode on cmd
+
+	for (uint8_t n = 0; n < EPAPER_Stale_Count; n++)
+	{
+		EPAPER_TRACE_SECTION(EPAPER_SECTION_STALE, EPAPER_Stale_Tags[n]);
+		EPAPER_Set_Window(&EPAPER_Stale[n]);
+		EPAPER_Send_Old(&EPAPER_Stale[n]);
+	}
+
+	for (uint8_t n = 0; n < EPAPER_Dirty_Count; n++)
+	{
+		const EPAPER_Rect *r = &EPAPER_Dirty[n];
+		uint16_t first_byte = r->x_start >> 3;
+		uint16_t last_byte = r->x_end >> 3;
+
+		EPAPER_TRACE_SECTION(EPAPER_SECTION_REGION, EPAPER_Dirty_Tags[n]);
+		EPAPER_Set_Window(r);
+		EPAPER_Send_Old(r);
+		EPAPER_SendCommand(0x13);
+		if (first_byte == 0 && last_byte == EPAPER_BYTE_WIDTH - 1)
+		{
+			/* full lines are contiguous in the frame buffer */
+			EPAPER_Send_nData(&EPAPER_Frame[r->y_start * EPAPER_BYTE_WIDTH], (r->y_end - r->y_start + 1) * EPAPER_BYTE_WIDTH);
+		}
+		else
+		{
+			for (uint16_t j = r->y_start; j <= r->y_end; j++)
+			{
+				EPAPER_Send_nData(&EPAPER_Frame[first_byte + j * EPAPER_BYTE_WIDTH], last_byte - first_byte + 1);
+			}
+		}
+
+		EPAPER_Rect_Union(&bounds, r);
+		tags |= EPAPER_Dirty_Tags[n];
+		EPAPER_Ghost_Account(r, EPAPER_LUT_Next);
+	}
+
+	/* the full waveform drives every pixel, red ones go back to white */
+	if (EPAPER_LUT_Next == EPAPER_LUT_FULL && EPAPER_Red_Draw != NULL)
+		EPAPER_Red_Dirty = 1;
+
+	EPAPER_TRACE_SECTION(EPAPER_SECTION_REFRESH, tags);
+	EPAPER_Set_Window(&bounds);
+	memcpy(EPAPER_Stale, EPAPER_Dirty, EPAPER_Dirty_Count * sizeof(EPAPER_Rect));
+	memcpy(EPAPER_Stale_Tags, EPAPER_Dirty_Tags, EPAPER_Dirty_Count * sizeof(uint16_t));
+	EPAPER_Stale_Count = EPAPER_Dirty_Count;
+	EPAPER_Dirty_Count = 0;
+	EPAPER_Journal_Commit();
+	EPAPER_Partial_Active = 1;
+	EPAPER_Refresh_Start(done);
+
+	return 1;
+}
+
+/******************************************************************************
+function :	push every changed region and wait for the refresh
+parameter:
+******************************************************************************/
+void EPAPER_Flush(void)
+{
+	if (EPAPER_Flush_Start(NULL))
+		EPAPER_Refresh_Wait();
+}
+
+/******************************************************************************
+function :	plot partial screen in KW mode
+parameter:
+    image: Image data
+    x_start: start x point
+    y_start: start y point
+    width: width
+    height: height
+
+Draws through the frame buffer and refreshes immediately, together with any
+other pending change.
+******************************************************************************/
+void EPAPER_KW_Partial_Display(const uint8_t *new_image, uint16_t x_start, uint16_t y_start, uint16_t width, uint16_t height)
+{
+	PROBE_BEGIN(PROBE_PARTIAL_DISPLAY);
+	EPAPER_FB_Blit(new_image, x_start, y_start, width, height);
+	EPAPER_Flush();
+	PROBE_END(PROBE_PARTIAL_DISPLAY);
+}
+
+/******************************************************************************
+function :	plot full screen in KW mode
+parameter:
+******************************************************************************/
+void EPAPER_KW_White_Display(void)
+{
+	EPAPER_Refresh_Wait();
+	EPAPER_TRACE_UPDATE();
+	EPAPER_TRACE_SECTION(EPAPER_SECTION_SCREEN, 0);
+
+	EPAPER_SendCommand(0x13); //buffer for new image
+	EPAPER_Send_Fill(0xFF, EPAPER_BUFFER_SIZE);
+
+	EPAPER_Refresh_Mode(EPAPER_LUT_FULL);
+	EPAPER_refresh();
+
+	/* both planes white, nothing left to drive */
+	EPAPER_SendCommand(0x10);
+	EPAPER_Send_Fill(0xFF, EPAPER_BUFFER_SIZE);
+
+	memset(EPAPER_Frame, 0xFF, sizeof(EPAPER_Frame));
+	EPAPER_Dirty_Count = 0;
+	EPAPER_Stale_Count = 0;
+	EPAPER_Journal_Commit();
+	if (EPAPER_Red_Draw != NULL)
+		EPAPER_Red_Dirty = 1;
+
+	/* nothing drawn is left, the widgets draw themselves with the next update */
+	EPAPER_Sky_Icon = NULL;
+	EPAPER_Widget_Invalidate();
+}
+
+/******************************************************************************
+function :	Clear screen
+parameter:
+******************************************************************************/
+void EPAPER_Clear(void)
+{
+	EPAPER_Refresh_Wait();
+	EPAPER_TRACE_UPDATE();
+	EPAPER_TRACE_SECTION(EPAPER_SECTION_SCREEN, 0);
+
+	EPAPER_SendCommand(0x10);
+	EPAPER_Send_Fill(0x00, EPAPER_BUFFER_SIZE);
+
+	EPAPER_SendCommand(0x13);
+	EPAPER_Send_Fill(0x00, EPAPER_BUFFER_SIZE);
+
+	EPAPER_Refresh_Mode(EPAPER_LUT_FULL);
+	EPAPER_refresh();
+	EPAPER_Stale_Count = 0;
+	EPAPER_Panel_Cleared = 1;
+	if (EPAPER_Red_Draw != NULL)
+		EPAPER_Red_Dirty = 1;
+}
+
+/******************************************************************************
+function :	set the layer drawn on the red plane
+parameter:
+    draw: draws the red content with the usual functions (0x00 = red),
+          NULL when there is no red content
+
+The callback is run once per band while the red plane is sent, it must only
+draw and always draw the same content until the layer is invalidated. The
+red plane is sent by the next EPAPER_Red_Flush.
+******************************************************************************/
+void EPAPER_Red_Layer(EPAPER_Draw_Callback draw)
+{
+	if (draw == NULL && EPAPER_Red_Draw == NULL)
+		return;
+
+	EPAPER_Red_Draw = draw;
+	EPAPER_Red_Dirty = 1;
+}
+
+/******************************************************************************
+function :	the red layer content changed, send it with the next EPAPER_Red_Flush
+parameter:
+******************************************************************************/
+void EPAPER_Red_Invalidate(void)
+{
+	EPAPER_Red_Dirty = 1;
+}
+
+/******************************************************************************
+function :	send one data plane of a black / white / red refresh
+parameter:
+    cmd: 0x10 for the black plane, 0x13 for the red plane
+
+The red layer is drawn in a band of the scratch arena. Pixels drawn in red
+are sent white on the black plane.
+******************************************************************************/
+static void EPAPER_Red_Send(uint8_t cmd)
+{
+	size_t mark = Scratch_Mark();
+	uint8_t *band = Scratch_Alloc(EPAPER_RED_BAND * EPAPER_BYTE_WIDTH);
+
+	EPAPER_SendCommand(cmd);
+	for (uint16_t start = 0; start < EPAPER_HEIGHT; start += EPAPER_RED_BAND)
+	{
+		const uint8_t *frame = &EPAPER_Frame[start * EPAPER_BYTE_WIDTH];
+		uint16_t len = EPAPER_RED_BAND * EPAPER_BYTE_WIDTH;
+
+		if (band == NULL)
+		{
+			/* no room for the band: no red at all */
+			if (cmd == 0x10)
+				EPAPER_Send_nData(frame, len);
+			else
+				EPAPER_Send_Fill(0xFF ^ EPAPER_RED_POLARITY, len);
+			continue;
+		}
+
+		memset(band, 0xFF, len);
+		if (EPAPER_Red_Draw != NULL)
+		{
+			EPAPER_Band = band;
+			EPAPER_Band_Start = start;
+			EPAPER_Red_Draw();
+			EPAPER_Band = NULL;
+		}
+
+		for (uint16_t i = 0; i < len; i++)
+		{
+			if (cmd == 0x10)
+				band[i] = frame[i] | (uint8_t)~band[i];
+			else
+				band[i] ^= EPAPER_RED_POLARITY;
+		}
+		EPAPER_Send_nData(band, len);
+	}
+	Scratch_Release(mark);
+}
+
+/******************************************************************************
+function :	black / white / red refresh if the red layer changed
+parameter:
+return   :  1 if the panel was refreshed
+
+Slow (full refresh with the OTP waveform) and blocking, so red changes are
+batched here while black only changes keep going through EPAPER_Flush_Start.
+Pending black changes are sent with it, then the panel is put back in KW
+partial mode with both data planes holding the frame buffer.
+******************************************************************************/
+uint8_t EPAPER_Red_Flush(void)
+{
+	if (!EPAPER_Red_Dirty)
+		return 0;
+
+	EPAPER_Refresh_Wait();
+	EPAPER_TRACE_UPDATE();
+	EPAPER_Init();
+	EPAPER_TRACE_SECTION(EPAPER_SECTION_SCREEN, 1U << EPAPER_TAG_RED);
+	EPAPER_Red_Send(0x10);
+	EPAPER_Red_Send(0x13);
+	EPAPER_refresh();
+
+	EPAPER_Part_Init();
+	EPAPER_TRACE_SECTION(EPAPER_SECTION_SCREEN, 1U << EPAPER_TAG_RED);
+	EPAPER_SendCommand(0x10);
+	EPAPER_Send_nData(EPAPER_Frame, EPAPER_BUFFER_SIZE);
+	EPAPER_SendCommand(0x13);
+	EPAPER_Send_nData(EPAPER_Frame, EPAPER_BUFFER_SIZE);
+
+	EPAPER_Rect all = {0, 0, EPAPER_WIDTH - 1, EPAPER_HEIGHT - 1};
+	EPAPER_Ghost_Account(&all, EPAPER_LUT_FULL);
+	EPAPER_Dirty_Count = 0;
+	EPAPER_Stale_Count = 0;
+	EPAPER_Journal_Commit();
+	EPAPER_Red_Dirty = 0;
+	return 1;
+}
+
+/******************************************************************************
+function :	select the waveform of the next refresh
+parameter:
+    mode: EPAPER_LUT_FAST, EPAPER_LUT_PARTIAL or EPAPER_LUT_FULL
+
+Only lasts for one refresh, the following ones go back to EPAPER_LUT_PARTIAL.
+******************************************************************************/
+void EPAPER_Refresh_Mode(EPAPER_LUT_Mode mode)
+{
+	if (mode < EPAPER_LUT_COUNT)
+		EPAPER_LUT_Next = mode;
+}
+
+/******************************************************************************
+function :	pick the temperature band of the waveforms
+parameter:
+    temp: panel temperature in 0.1 °C, as returned by BME_Read_Data
+
+A band is only left once the temperature is EPAPER_LUT_HYSTERESIS past its
+edge, so a reading hovering on a boundary does not reload the LUT every minute.
+******************************************************************************/
+void EPAPER_Set_Temperature(int temp)
+{
+	uint8_t band = EPAPER_LUT_Band_Index;
+
+	while (band > 0 && temp < EPAPER_lut_band[band].min_temp - EPAPER_LUT_HYSTERESIS)
+		band--;
+	while (band < EPAPER_LUT_BANDS - 1 && temp >= EPAPER_lut_band[band + 1].min_temp + EPAPER_LUT_HYSTERESIS)
+		band++;
+
+	EPAPER_LUT_Band_Index = band;
+}
+
+/******************************************************************************
+function :	send one waveform register, frame counts scaled for the band
+parameter:
+    cmd: LUT register 0x20 to 0x24
+    lut: EPAPER_LUT_SIZE bytes
+    scale: in 1/16, 16 sends the table unchanged
+******************************************************************************/
+static void EPAPER_LUT_Send(uint8_t cmd, const uint8_t *lut, uint8_t scale)
+{
+	uint8_t buf[EPAPER_LUT_SIZE];
+
+	memcpy(buf, lut, EPAPER_LUT_SIZE);
+	for (uint8_t i = 0; i < EPAPER_LUT_SIZE; i += 7)
+	{
+		for (uint8_t p = 1; p <= 4; p++)
+		{
+			uint16_t frames = buf[i + p] & 0x3F;
+			if (frames == 0)
+				continue;
+			frames = (frames * scale + 8) >> 4;
+			if (frames < 1) frames = 1;
+			if (frames > 0x3F) frames = 0x3F;
+			buf[i + p] = (buf[i + p] & 0xC0) | frames;
+		}
+	}
+
+	EPAPER_SendCommand(cmd);
+	EPAPER_Send_nData(buf, EPAPER_LUT_SIZE);
+}
+
+/******************************************************************************
+function :	load the selected waveform in the LUT registers
+parameter:
+
+Does nothing while the panel runs from its OTP waveform or when the
+registers already hold the selected profile and band.
+******************************************************************************/
+void EPAPER_lut(void)
+{
+	uint8_t key = (EPAPER_LUT_Band_Index << 4) | EPAPER_LUT_Next;
+	const EPAPER_LUT_Set *set = &EPAPER_lut_set[EPAPER_LUT_Next];
+	uint8_t scale = EPAPER_lut_band[EPAPER_LUT_Band_Index].scale;
+
+	if (!EPAPER_LUT_Registers || key == EPAPER_LUT_Loaded)
+		return;
+
+	EPAPER_TRACE_SECTION(EPAPER_SECTION_LUT, 0);
+	EPAPER_LUT_Send(0x20, set->vcom, scale);    // vcom
+	EPAPER_LUT_Send(0x21, set->ww, scale);      // ww --
+	EPAPER_LUT_Send(0x22, set->bw, scale);      // bw r
+	EPAPER_LUT_Send(0x23, set->wb, scale);      // wb w
+	EPAPER_LUT_Send(0x24, set->bb, scale);      // bb b
+
+	EPAPER_LUT_Loaded = key;
+}
+
+/******************************************************************************
+function :	clean refresh of a region with the full waveform
+parameter:
+    rect: region, panel coordinates
+
+The region is sent with the next flush, with the inverted image as old
+plane (the panel is not told what it shows): every pixel in it is driven
+through the full bw / wb waveforms.
+******************************************************************************/
+void EPAPER_Clean_Region(const EPAPER_Rect *rect)
+{
+	EPAPER_TRACE_TAG(EPAPER_TAG_CLEAN);
+	EPAPER_FB_Mark(rect->x_start, rect->y_start, rect->x_end - rect->x_start + 1, rect->y_end - rect->y_start + 1);
+	EPAPER_Journal_Invert(rect);
+	EPAPER_TRACE_TAG(EPAPER_TAG_OTHER);
+	EPAPER_Refresh_Mode(EPAPER_LUT_FULL);
+}
+
+/******************************************************************************
+function :	refresh screen to remove glitch
+parameter:
+
+Clears the panel with the OTP waveform then draws the frame buffer back, the
+content does not need to be printed again.
+******************************************************************************/
+void EPAPER_Full_Refresh(void)
+{
+	EPAPER_Init();
+	EPAPER_Clear();
+	EPAPER_Part_Init();
+
+	EPAPER_Dirty_Count = 0;
+	EPAPER_TRACE_TAG(EPAPER_TAG_CLEAN);
+	EPAPER_FB_Mark(0, 0, EPAPER_WIDTH, EPAPER_HEIGHT);
+	EPAPER_TRACE_TAG(EPAPER_TAG_OTHER);
+	EPAPER_Refresh_Mode(EPAPER_LUT_FULL);
+	EPAPER_Flush_Start(NULL);
+}
+
+/******************************************************************************
+function :	draw the screen again after a warm restart
+parameter:
+
+The panel still shows the image of before the reset but the frame buffer is
+lost. The registered widgets draw themselves on a white frame, which is then
+sent with its inverse as old plane and driven everywhere with the full bw /
+wb waveforms: one refresh, without the clear and white passes of a cold boot. The panel
+must be initialised with EPAPER_Part_Init and the widgets given their values.
+******************************************************************************/
+void EPAPER_Restore_Display(void)
+{
+	EPAPER_Refresh_Wait();
+
+	memset(EPAPER_Frame, 0xFF, sizeof(EPAPER_Frame));
+	EPAPER_Dirty_Count = 0;
+	EPAPER_Stale_Count = 0;
+	EPAPER_Sky_Icon = NULL;
+	EPAPER_Widget_Invalidate();
+	EPAPER_Widget_Draw();
+
+	/* what the panel shows is unknown, every pixel is driven to the frame */
+	EPAPER_Rect all = {0, 0, EPAPER_WIDTH - 1, EPAPER_HEIGHT - 1};
+	EPAPER_Dirty_Count = 0;
+	EPAPER_Journal_Commit();
+	EPAPER_Clean_Region(&all);
+	EPAPER_Flush_Start(NULL);
+}
+
+/******************************************************************************
+function :	dup n time pixel inside input
+parameter:
+    output: mult bytes
+    mult 2 to EPAPER_EXPAND_MAX are read from the generated tables,
+    bigger factors fall back to the bit loop
+******************************************************************************/
+void EPAPER_Dup_Bits(const uint8_t input, uint8_t *output, uint8_t mult)
+{
+	if (mult <= 0) return;
+
+	if (mult == 1) {
+		output[0] = input;
+		return;
+	}
+
+	if (mult <= EPAPER_EXPAND_MAX) {
+		memcpy(output, EPAPER_expand[mult] + input*mult, mult);
+		return;
+	}
+
+	uint16_t bit_pos = 0;
+	uint8_t bit = 0;
+	uint8_t byte_index = 0;
+	uint8_t bit_index = 0;
+
+    uint8_t output_bytes = (8 * mult + 7) / 8; // Round up to nearest byte
+    for (uint8_t i = 0; i < output_bytes; i++) {
+        output[i] = 0;
+    }
+
+	for (int8_t b = 7; b>=0; b--)
+	{
+		bit = (input>>b) & 1;
+		for (uint8_t k = 0; k < mult; k++)
+		{
+			byte_index = bit_pos / 8;
+			bit_index = 7 - (bit_pos % 8);
+			if(bit) output[byte_index] |= (1<<bit_index);
+			bit_pos++;
+		}
+	}
+}
+
+/******************************************************************************
+function :	increase image by mult (horizontal image)
+parameter:
+    image: Image data
+    mult_image: buffer that will contain the multiply image (mult_image need to be big enought)
+    byte_width: number of byte per column
+    height: number of pixel per line
+******************************************************************************/
+void EPAPER_Size_Mult(const uint8_t *image, uint8_t *mult_image, uint8_t mult, uint16_t byte_width, uint16_t height)
+{
+	if(mult == 0 || byte_width*mult*8 > 240 || height*mult > 360){
+		return;
+	}
+
+	uint16_t row_bytes = byte_width*mult;
+
+	PROBE_BEGIN(PROBE_SIZE_MULT);
+	for (uint16_t j = 0; j < height; j++)
+	{
+		// expand one source line, then repeat it mult-1 times below
+		uint8_t *row = mult_image;
+		for (uint16_t i = 0; i < byte_width; i++)
+		{
+			EPAPER_Dup_Bits(*image++, row, mult);
+			row += mult;
+		}
+
+		for (uint8_t k = 1; k < mult; k++)
+		{
+			memcpy(mult_image + k*row_bytes, mult_image, row_bytes);
+		}
+		mult_image += mult*row_bytes;
+	}
+	PROBE_END(PROBE_SIZE_MULT);
+}
+
+/******************************************************************************
+function :	print char
+parameter:
+    image: 5 glyph columns from bpixel
+    x_start: left of the char on screen
+    y_start: top of the char on screen
+******************************************************************************/
+void EPAPER_Print_Char(const uint8_t *image,  uint8_t size, uint16_t x_start, uint16_t y_start)
+{
+	if(size == 1){
+		EPAPER_Draw_Image(image, 8, 5, EPAPER_FONT_ROTATION, x_start, y_start);
+		return;
+	}
+
+	size_t mark = Scratch_Mark();
+	uint8_t *image_buf = Scratch_Alloc(5*size*size);
+
+	if (image_buf != NULL) {
+		EPAPER_Size_Mult(image, image_buf, size, 1, 5);
+		EPAPER_Draw_Image(image_buf, 8*size, 5*size, EPAPER_FONT_ROTATION, x_start, y_start);
+	}
+	Scratch_Release(mark);
+}
+
+/******************************************************************************
+function :	decode a compressed bitmap into the frame buffer
+parameter:
+    bitmap: bitmap from pixel_assets.c, stored with EPAPER_FONT_ROTATION
+    x: left of the bitmap on screen
+    y: top of the bitmap on screen
+
+The bitmap is decoded 8 stored lines at a time, each band is drawn with
+EPAPER_Draw_Image so any EPAPER_ROTATION works.
+******************************************************************************/
+void EPAPER_Print_Bitmap(const EPAPER_Bitmap *bitmap, uint16_t x, uint16_t y)
+{
+	size_t mark = Scratch_Mark();
+	uint8_t *band = Scratch_Alloc(8 * EPAPER_BYTE_WIDTH);
+	EPAPER_RLE rle;
+
+	if (band == NULL || bitmap == NULL || bitmap->width > EPAPER_WIDTH)
+	{
+		Scratch_Release(mark);
+		return;
+	}
+
+	uint16_t byte_width = bitmap->width / 8;
+	uint16_t w = (EPAPER_FONT_ROTATION & 1) ? bitmap->height : bitmap->width;
+	uint16_t h = (EPAPER_FONT_ROTATION & 1) ? bitmap->width : bitmap->height;
+
+	EPAPER_RLE_Init(&rle, bitmap);
+	for (uint16_t j = 0; j < bitmap->height; j += 8)
+	{
+		uint8_t lines = (bitmap->height - j < 8) ? bitmap->height - j : 8;
+		uint16_t band_x = x;
+		uint16_t band_y = y;
+
+		EPAPER_RLE_Read(&rle, band, lines * byte_width);
+
+		// screen position of stored lines j .. j+lines-1
+		switch (EPAPER_FONT_ROTATION)
+		{
+			case EPAPER_ROTATE_90:  band_x = x + j; break;
+			case EPAPER_ROTATE_180: band_y = y + h - j - lines; break;
+			case EPAPER_ROTATE_270: band_x = x + w - j - lines; break;
+			default:                band_y = y + j; break;
+		}
+		EPAPER_Draw_Image(band, bitmap->width, lines, EPAPER_FONT_ROTATION, band_x, band_y);
+	}
+	Scratch_Release(mark);
+}
+
+static inline uint8_t char_pixel_width(char c)
+{
+    if (c == ' ' || c == ',')
+        return 3;   // 2 pixels glyph + 1 spacing
+    else
+        return 6;   // 5 pixels glyph + 1 spacing
+}
+
+static uint16_t font_index(char c)
+{
+    if (c >= '0' && c <= '9')
+        return (c - '0') * 5;
+    else if (c >= 'A' && c <= 'Z')
+        return (c - 'A' + 10) * 5;
+    else if (c >= 'a' && c <= 'z')
+        return (c - 'a' + 36) * 5;
+    else if (c == '*')
+        return 62 * 5;
+    else if (c == '-')
+        return 63 * 5;
+    else if (c == '%')
+        return 64 * 5;
+    else if (c == ' ')
+        return 65 * 5;
+    else
+        return (65 * 5 + 2); // , / unknown
+}
+
+/******************************************************************************
+function :	draw one line of text, scaled by size a chunk at a time
+parameter:
+    line_buf: glyph columns of the line, used first ones are drawn
+    chunk: EPAPER_TEXT_CHUNK * size bytes, NULL for size 1
+    width_px: span of the line on screen, blank after the text
+
+The columns past the text are blanked, the whole span is drawn so the end
+of a longer previous text is erased.
+******************************************************************************/
+static void EPAPER_Print_Line(uint8_t *line_buf, uint16_t used, uint8_t *chunk, uint8_t size, uint16_t width_px, uint16_t x, uint16_t y)
+{
+	memset(&line_buf[used], 0xFF, width_px / size + 1 - used);
+
+	if (size == 1) {
+		EPAPER_Draw_Image(line_buf, 8, width_px, EPAPER_FONT_ROTATION, x, y);
+		return;
+	}
+
+	uint16_t step = (EPAPER_TEXT_CHUNK / size) * size;     // whole source columns
+	for (uint16_t done = 0; done < width_px; done += step) {
+		uint16_t rows = width_px - done < step ? width_px - done : step;
+		EPAPER_Size_Mult(&line_buf[done / size], chunk, size, 1, (rows + size - 1) / size);
+		EPAPER_Draw_Image(chunk, 8 * size, rows, EPAPER_FONT_ROTATION, x + done, y);
+	}
+}
+
+/******************************************************************************
+function :	print string
+parameter:
+    size: scale of the 5x8 font
+    x_start, x_end: horizontal span on screen, longer text wraps
+    y_start: top of the first line on screen
+******************************************************************************/
+void EPAPER_Print_String(const char *string,  uint8_t size, uint16_t x_start, uint16_t x_end, uint16_t y_start)
+{
+	// can't have size equal to 0
+	if (!string || size == 0)
+	        return;
+
+	uint16_t max_width_px = x_end - x_start;
+	uint16_t max_height_px = EPAPER_SCREEN_HEIGHT - y_start;
+
+	if (max_width_px < 6 * size || max_height_px < 8 * size)
+	        return;
+
+	// glyph columns of one line, then a chunk of it scaled by size
+	size_t mark = Scratch_Mark();
+	uint16_t line_len = max_width_px / size + 1;
+	uint8_t *line_buf = Scratch_Alloc(line_len);
+	uint8_t *chunk = size == 1 ? NULL : Scratch_Alloc(EPAPER_TEXT_CHUNK * size);
+
+	if (line_buf == NULL || (size != 1 && chunk == NULL)) {
+		Scratch_Release(mark);
+		return;
+	}
+
+	uint16_t x_cursor_px = 0;
+	uint16_t y_cursor_px = 0;
+	uint16_t width_for_mult = 0;
+
+	// Clear buffer
+	memset(line_buf, 0xFF, line_len);
+
+	while (*string) {
+
+		uint8_t char_w = char_pixel_width(*string);
+		uint16_t scaled_w = char_w * size;
+
+		// Wrap line if needed
+		if (x_cursor_px + scaled_w > max_width_px) {
+
+			// Draw current line
+			EPAPER_Print_Line(line_buf, width_for_mult, chunk, size, max_width_px, x_start, y_start + y_cursor_px);
+
+			// Move to next line
+			memset(line_buf, 0xFF, line_len);
+			x_cursor_px = 0;
+			width_for_mult = 0;
+
+			y_cursor_px += 8 * size;
+			if (y_cursor_px + 8 * size > max_height_px)
+				break;
+		}
+
+		uint16_t buf_index = x_cursor_px / size;
+		uint16_t ind = font_index(*string);
+
+		if (*string == ' ' || *string == ',') {
+			memcpy(&line_buf[buf_index], &bpixel[ind], 2);
+		} else {
+			memcpy(&line_buf[buf_index], &bpixel[ind], 5);
+		}
+
+		x_cursor_px += scaled_w;
+		width_for_mult += char_w;
+		string++;
+	}
+
+	// Flush last line
+	if (x_cursor_px > 0) {
+		EPAPER_Print_Line(line_buf, width_for_mult, chunk, size, max_width_px, x_start, y_start + y_cursor_px);
+	}
+
+	Scratch_Release(mark);
+}
+
+/* 49 * sin(t * pi / 360), t = 0 .. 180 : quarter turn of the sky path corners */
+static const uint8_t EPAPER_Sky_Arc[181] = {
+	 0,  0,  1,  1,  2,  2,  3,  3,  3,  4,  4,  5,  5,  6,  6,  6,
+	 7,  7,  8,  8,  9,  9,  9, 10, 10, 11, 11, 11, 12, 12, 13, 13,
+	14, 14, 14, 15, 15, 16, 16, 16, 17, 17, 18, 18, 18, 19, 19, 20,
+	20, 20, 21, 21, 21, 22, 22, 23, 23, 23, 24, 24, 24, 25, 25, 26,
+	26, 26, 27, 27, 27, 28, 28, 28, 29, 29, 29, 30, 30, 31, 31, 31,
+	31, 32, 32, 32, 33, 33, 33, 34, 34, 34, 35, 35, 35, 36, 36, 36,
+	36, 37, 37, 37, 38, 38, 38, 38, 39, 39, 39, 39, 40, 40, 40, 40,
+	41, 41, 41, 41, 42, 42, 42, 42, 42, 43, 43, 43, 43, 43, 44, 44,
+	44, 44, 44, 45, 45, 45, 45, 45, 45, 46, 46, 46, 46, 46, 46, 46,
+	47, 47, 47, 47, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49
+};
+
+/******************************************************************************
+function :	position of the sun / moon icon
+parameter:  min, minute from 0h00
+			h_pos, along the screen
+			v_pos, height above the bottom edge
+
+The icon runs around a rounded rectangle once a day: 4 straight sides of
+77 pixels and 4 quarter circles of radius 49, 180 minutes each, integer only.
+******************************************************************************/
+static void EPAPER_Sky_Position(uint16_t min, uint16_t *h_pos, uint16_t *v_pos)
+{
+	uint16_t t;
+
+	min %= 1440;
+	if (min < 90) {
+		*v_pos = 0;
+		*h_pos = (16470 - min * 77) / 180;      // 91.5 down to 53
+	}
+	else if (min < 270) {
+		t = min - 90;
+		*v_pos = 49 - EPAPER_Sky_Arc[180 - t];
+		*h_pos = 51 - EPAPER_Sky_Arc[t];
+	}
+	else if (min < 450) {
+		t = min - 270;
+		*v_pos = 49 + t * 77 / 180;
+		*h_pos = 2;
+	}
+	else if (min < 630) {
+		t = min - 450;
+		*v_pos = 126 + EPAPER_Sky_Arc[t];
+		*h_pos = 51 - EPAPER_Sky_Arc[180 - t];
+	}
+	else if (min < 810) {
+		t = min - 630;
+		*v_pos = 176;
+		*h_pos = 51 + t * 77 / 180;
+	}
+	else if (min < 990) {
+		t = min - 810;
+		*v_pos = 126 + EPAPER_Sky_Arc[180 - t];
+		*h_pos = 128 + EPAPER_Sky_Arc[t];
+	}
+	else if (min < 1170) {
+		t = min - 990;
+		*v_pos = 126 - t * 77 / 180;
+		*h_pos = 178;
+	}
+	else if (min < 1350) {
+		t = min - 1170;
+		*v_pos = 49 - EPAPER_Sky_Arc[t];
+		*h_pos = 128 + EPAPER_Sky_Arc[180 - t];
+	}
+	else {
+		t = min - 1350;
+		*v_pos = 0;
+		*h_pos = 128 - t * 77 / 180;
+	}
+}
+
+/******************************************************************************
+function :	print the sun, or the moon phase, along its daily path
+parameter:  moon_phase, 0 to 8, index in moon_icon
+			min, minute from 0h00
+			rise_time, fall_time, minutes the sun is shown between
+
+The icon is moved as a sprite: the previous box is erased and the new icon
+drawn, both inside one dirty region so a single window is refreshed.
+******************************************************************************/
+void EPAPER_Print_Moon_Phase(uint8_t moon_phase, uint16_t min, uint16_t rise_time, uint16_t fall_time)
+{
+	const EPAPER_Bitmap *icon;
+	uint16_t h_pos, v_pos;
+	EPAPER_Rect old_box, box;
+
+	EPAPER_Sky_Position(min, &h_pos, &v_pos);
+
+	// 32x32 icons from tools/assets, one per moon phase
+	// h_pos runs along the screen, v_pos is the height above the bottom edge
+	if(min>rise_time && min<fall_time){
+		icon = &sun_icon;
+	}
+	else
+	{
+		if(moon_phase > 8) moon_phase = 0;
+		icon = &moon_icon[moon_phase];
+	}
+
+	uint16_t x = h_pos;
+	uint16_t y = EPAPER_SCREEN_HEIGHT - EPAPER_ICON_SIZE - v_pos;
+
+	if (icon == EPAPER_Sky_Icon && x == EPAPER_Sky_X && y == EPAPER_Sky_Y)
+		return;
+	if (EPAPER_Screen_Rect(x, y, EPAPER_ICON_SIZE, EPAPER_ICON_SIZE, &box) != 0)
+		return;
+
+	EPAPER_TRACE_TAG(EPAPER_TAG_MOON);
+
+	if (EPAPER_Sky_Icon != NULL &&
+		EPAPER_Screen_Rect(EPAPER_Sky_X, EPAPER_Sky_Y, EPAPER_ICON_SIZE, EPAPER_ICON_SIZE, &old_box) == 0)
+	{
+		EPAPER_FB_Fill(old_box.x_start, old_box.y_start, EPAPER_ICON_SIZE, EPAPER_ICON_SIZE, 0xFF);
+		EPAPER_Rect_Union(&box, &old_box);
+	}
+
+	EPAPER_Print_Bitmap(icon, x, y);
+	EPAPER_FB_Mark(box.x_start, box.y_start, box.x_end - box.x_start + 1, box.y_end - box.y_start + 1);
+	EPAPER_TRACE_TAG(EPAPER_TAG_OTHER);
+
+	EPAPER_Sky_Icon = icon;
+	EPAPER_Sky_X = x;
+	EPAPER_Sky_Y = y;
+}
+
+
+/******************************************************************************
+function :	print hour with the 40x64 digit_large font
+parameter:  min ,minute from 0h00
+			prev_min, previous minute from 0h00
+******************************************************************************/
+void EPAPER_Print_Hour(uint16_t min,  uint16_t prev_min)
+{
+	uint8_t first_digit;
+	uint8_t second_digit;
+	uint8_t third_digit;
+	uint8_t fourth_digit;
+	uint16_t x_pos = 60;
+	uint16_t y_hour = 72;   // hours above minutes
+	uint16_t y_min = 136;
+
+	EPAPER_TRACE_TAG(EPAPER_TAG_HOUR);
+	if(prev_min/600 != min/600){
+		first_digit = min/600;
+		EPAPER_Print_Bitmap(EPAPER_Font_Glyph(&digit_large, '0' + first_digit), x_pos, y_hour);
+	}
+
+	if(prev_min/60 != min/60){
+		second_digit = (min%600)/60;
+		EPAPER_Print_Bitmap(EPAPER_Font_Glyph(&digit_large, '0' + second_digit), 108, y_hour);
+	}
+
+	if(prev_min/10 != min/10){
+		third_digit = (min%60)/10;
+		EPAPER_Print_Bitmap(EPAPER_Font_Glyph(&digit_large, '0' + third_digit), x_pos, y_min);
+	}
+
+	if(prev_min%10 != min%10){
+		fourth_digit = min%10;
+		EPAPER_Print_Bitmap(EPAPER_Font_Glyph(&digit_large, '0' + fourth_digit), 108, y_min);
+	}
+	EPAPER_TRACE_TAG(EPAPER_TAG_OTHER);
+}
+
+/******************************************************************************
+function :	print date
+parameter:  day , 0 to 6 for monday to sunday
+			dd, day of the mounth
+			mm, 0 to 11 for january to december
+******************************************************************************/
+void EPAPER_Print_Date(uint8_t day,  uint8_t dd, uint8_t mm)
+{
+	char date[21] = "";
+	switch(day){
+		case 0:
+			//lundi
+			strcat(date, "Lundi ");
+			break;
+
+		case 1:
+			//mardi
+			strcat(date, "Mardi ");
+			break;
+
+		case 2:
+			//mercredi
+			strcat(date, "Mercredi ");
+			break;
+
+		case 3:
+			//jeudi
+			strcat(date, "Jeudi ");
+			break;
+
+		case 4:
+			//vendredi
+			strcat(date, "Vendredi ");
+			break;
+
+		case 5:
+			//samedi
+			strcat(date, "Samedi ");
+			break;
+
+		case 6:
+			//dimanche
+			strcat(date, "Dimanche ");
+			break;
+
+		default:
+			//lundi
+			strcat(date, "Lundi ");
+	}
+
+	char char_dd[11]; // any %u
+	snprintf(char_dd, sizeof(char_dd), "%u", dd);
+	strcat(date, char_dd);
+
+	switch(mm){
+		case 0:
+			//janvier
+			strcat(date, " janvier");
+			break;
+
+		case 1:
+			//fevrier
+			strcat(date, " fevrier");
+			break;
+
+		case 2:
+			//mars
+			strcat(date, " mars");
+			break;
+
+		case 3:
+			//avril
+			strcat(date, " avril");
+			break;
+
+		case 4:
+			//mai
+			strcat(date, " mai");
+			break;
+
+		case 5:
+			//juin
+			strcat(date, " juin");
+			break;
+
+		case 6:
+			//juillet
+			strcat(date, " juillet");
+			break;
+
+		case 7:
+			//aout
+			strcat(date, " aout");
+			break;
+
+		case 8:
+			//septembre
+			strcat(date, " septembre");
+			break;
+
+		case 9:
+			//octobre
+			strcat(date, " octobre");
+			break;
+
+		case 10:
+			//novembre
+			strcat(date, " novembre");
+			break;
+
+		case 11:
+			//decembre
+			strcat(date, " decembre");
+			break;
+
+		default:
+			//janvier
+			strcat(date, " janvier");
+	}
+	EPAPER_TRACE_TAG(EPAPER_TAG_DATE);
+	EPAPER_Print_String(date,  3, 0, 360, 8);
+	EPAPER_TRACE_TAG(EPAPER_TAG_OTHER);
+}
+
+/******************************************************************************
+function :	print temperature
+parameter:  temp: temperature
+******************************************************************************/
+void EPAPER_Print_temp(int temp)
+{
+	char string_temp[26]; // any two int, the clamp below keeps it to 6 characters
+	int dec_temp = temp%10;
+	int num_temp = temp/10;
+	if(temp <= 0)
+	{
+		dec_temp = 0;
+		num_temp = 0;
+	}
+	if(temp >= 1000)
+	{
+		dec_temp = 99;
+		num_temp = 9;
+	}
+	snprintf(string_temp, sizeof(string_temp), "%2d,%1d*C", num_temp, dec_temp);
+	EPAPER_TRACE_TAG(EPAPER_TAG_TEMP);
+	EPAPER_Print_String(string_temp,  4, 218, 360, 58);
+	EPAPER_TRACE_TAG(EPAPER_TAG_OTHER);
+}
+
+/******************************************************************************
+function :	print pression
+parameter:  press: pression
+******************************************************************************/
+void EPAPER_Print_press(uint32_t press)
+{
+	char string_press[15];
+	snprintf(string_press, sizeof(string_press), "%4lu hPa", (unsigned long)press);
+	EPAPER_TRACE_TAG(EPAPER_TAG_PRESS);
+	EPAPER_Print_String(string_press,  3, 215, 360, 206);
+	EPAPER_TRACE_TAG(EPAPER_TAG_OTHER);
+}
+
+/******************************************************************************
+function :	print humidity
+parameter:  hum: humidity in %
+******************************************************************************/
+void EPAPER_Print_hum(uint32_t hum)
+{
+	char string_hum[13];
+	snprintf(string_hum, sizeof(string_hum), "%2lu %%", (unsigned long)hum);
+	EPAPER_TRACE_TAG(EPAPER_TAG_HUM);
+	EPAPER_Print_String(string_hum,  4, 266, 360, 128);
+	EPAPER_TRACE_TAG(EPAPER_TAG_OTHER);
+}
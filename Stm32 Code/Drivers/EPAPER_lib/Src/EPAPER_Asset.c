@@ -0,0 +1,93 @@
+/*
+ * EPAPER_Asset.c
+ *
+ *  Streaming decoder for the bitmaps of pixel_assets.c
+ */
+
+#include "EPAPER_Asset.h"
+
+#define EPAPER_RLE_MORE 15
+
+/**
+ * @brief Take the next 4 bit count of the stream
+ */
+static uint8_t EPAPER_RLE_Nibble(EPAPER_RLE *rle)
+{
+	uint8_t n;
+
+	if (rle->high) {
+		n = *rle->src >> 4;
+		rle->high = 0;
+	} else {
+		n = *rle->src++ & 0x0F;
+		rle->high = 1;
+	}
+	return n;
+}
+
+/**
+ * @brief Load the length of the next run
+ */
+static void EPAPER_RLE_Next(EPAPER_RLE *rle)
+{
+	uint16_t run = 0;
+	uint8_t n;
+
+	while ((n = EPAPER_RLE_Nibble(rle)) == EPAPER_RLE_MORE)
+		run += EPAPER_RLE_MORE;
+	rle->run = run + n;
+}
+
+/**
+ * @brief Start decoding a bitmap
+ * @param rle Decoder state
+ * @param bitmap Bitmap to decode
+ */
+void EPAPER_RLE_Init(EPAPER_RLE *rle, const EPAPER_Bitmap *bitmap)
+{
+	rle->src = bitmap->data;
+	rle->high = 1;
+	rle->color = 0xFF;
+	EPAPER_RLE_Next(rle);
+}
+
+/**
+ * @brief Decode the next bytes of the bitmap
+ * @param rle Decoder state
+ * @param out Destination, len bytes
+ * @param len Number of bytes to decode, the caller must not read past the
+ *            end of the bitmap (height * width/8 bytes)
+ */
+void EPAPER_RLE_Read(EPAPER_RLE *rle, uint8_t *out, uint16_t len)
+{
+	while (len--) {
+		uint8_t byte = 0;
+		uint8_t bits = 8;
+
+		while (bits) {
+			while (rle->run == 0) {
+				rle->color ^= 0xFF;
+				EPAPER_RLE_Next(rle);
+			}
+
+			uint8_t n = (rle->run < bits) ? rle->run : bits;
+			bits -= n;
+			rle->run -= n;
+			byte |= (uint8_t)((rle->color & ((1u << n) - 1)) << bits);
+		}
+		*out++ = byte;
+	}
+}
+
+/**
+ * @brief Bitmap of a character
+ * @param font Font
+ * @param c Character
+ * @retval Glyph bitmap, NULL if the font does not have the character
+ */
+const EPAPER_Bitmap *EPAPER_Font_Glyph(const EPAPER_Font *font, char c)
+{
+	if (c < font->first || c >= font->first + font->count)
+		return NULL;
+	return &font->glyph[c - font->first];
+}
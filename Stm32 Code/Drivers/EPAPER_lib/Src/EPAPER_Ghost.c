@@ -0,0 +1,164 @@
+/*
+ * EPAPER_Ghost.c
+ *
+ *  Partial refresh counters per zone and the clean refresh scheduler
+ */
+
+#include "EPAPER_Ghost.h"
+
+EPAPER_Ghost_Policy EPAPER_ghost_policy = {
+	.max_count = 60,        // about an hour of minute updates
+	.max_age = 360,
+	.full_zones = EPAPER_GHOST_ZONES / 2,
+	.urgent = 3,
+	.quiet_start = 120,     // 2h to 5h
+	.quiet_end = 300,
+};
+
+static EPAPER_Ghost_Zone EPAPER_Ghost_Table[EPAPER_GHOST_ZONES];
+static EPAPER_Ghost_Stats EPAPER_Ghost_Counters;
+
+/**
+ * @brief Panel rectangle of a zone
+ */
+static void EPAPER_Ghost_Zone_Rect(uint8_t zone, EPAPER_Rect *rect)
+{
+	rect->x_start = (zone % EPAPER_GHOST_COLS) * EPAPER_GHOST_ZONE_WIDTH;
+	rect->y_start = (zone / EPAPER_GHOST_COLS) * EPAPER_GHOST_ZONE_HEIGHT;
+	rect->x_end = rect->x_start + EPAPER_GHOST_ZONE_WIDTH - 1;
+	rect->y_end = rect->y_start + EPAPER_GHOST_ZONE_HEIGHT - 1;
+}
+
+/**
+ * @brief Record a region sent to the panel
+ * @param rect Region, panel coordinates
+ * @param mode Waveform of the refresh, EPAPER_LUT_FULL cleans the zones
+ *             the region covers entirely
+ */
+void EPAPER_Ghost_Account(const EPAPER_Rect *rect, EPAPER_LUT_Mode mode)
+{
+	uint8_t col_start = rect->x_start / EPAPER_GHOST_ZONE_WIDTH;
+	uint8_t col_end = rect->x_end / EPAPER_GHOST_ZONE_WIDTH;
+	uint8_t row_start = rect->y_start / EPAPER_GHOST_ZONE_HEIGHT;
+	uint8_t row_end = rect->y_end / EPAPER_GHOST_ZONE_HEIGHT;
+
+	if (mode != EPAPER_LUT_FULL)
+		EPAPER_Ghost_Counters.regions++;
+
+	for (uint8_t row = row_start; row <= row_end && row < EPAPER_GHOST_ROWS; row++)
+	{
+		for (uint8_t col = col_start; col <= col_end && col < EPAPER_GHOST_COLS; col++)
+		{
+			uint8_t zone = row * EPAPER_GHOST_COLS + col;
+			EPAPER_Ghost_Zone *z = &EPAPER_Ghost_Table[zone];
+			EPAPER_Rect r;
+
+			EPAPER_Ghost_Zone_Rect(zone, &r);
+			if (mode == EPAPER_LUT_FULL &&
+				rect->x_start <= r.x_start && rect->x_end >= r.x_end &&
+				rect->y_start <= r.y_start && rect->y_end >= r.y_end)
+			{
+				z->count = 0;
+				z->age = 0;
+			}
+			else if (z->count < UINT16_MAX)
+			{
+				z->count++;
+			}
+		}
+	}
+}
+
+/**
+ * @brief Age the touched zones, call once a minute
+ */
+void EPAPER_Ghost_Tick(void)
+{
+	for (uint8_t i = 0; i < EPAPER_GHOST_ZONES; i++)
+	{
+		EPAPER_Ghost_Zone *z = &EPAPER_Ghost_Table[i];
+		if (z->count && z->age < UINT16_MAX)
+			z->age++;
+	}
+}
+
+/**
+ * @brief Tell if a zone passed the policy limits
+ * @param factor 1 for due, EPAPER_ghost_policy.urgent for urgent
+ */
+static uint8_t EPAPER_Ghost_Over(const EPAPER_Ghost_Zone *z, uint8_t factor)
+{
+	const EPAPER_Ghost_Policy *p = &EPAPER_ghost_policy;
+
+	if (z->count == 0)
+		return 0;
+	return (uint32_t)z->count >= (uint32_t)p->max_count * factor ||
+		   (uint32_t)z->age >= (uint32_t)p->max_age * factor;
+}
+
+/**
+ * @brief Schedule the clean refreshes, call once a minute
+ * @param minute Minute of the day, to find the quiet hours
+ * @retval EPAPER_GHOST_FULL if the screen was cleaned (blocking),
+ *         EPAPER_GHOST_REGIONAL if zones were queued for the next flush,
+ *         EPAPER_GHOST_NONE otherwise
+ *
+ * During the quiet hours every due zone is cleaned, the whole screen when
+ * there are at least full_zones of them. The rest of the day only the
+ * zones past urgent times the limits are cleaned.
+ */
+EPAPER_Ghost_Action EPAPER_Ghost_Service(uint16_t minute)
+{
+	const EPAPER_Ghost_Policy *p = &EPAPER_ghost_policy;
+	uint8_t quiet;
+	uint8_t due = 0;
+	uint8_t queued = 0;
+
+	if (p->quiet_start <= p->quiet_end)
+		quiet = minute >= p->quiet_start && minute < p->quiet_end;
+	else
+		quiet = minute >= p->quiet_start || minute < p->quiet_end;
+
+	for (uint8_t i = 0; i < EPAPER_GHOST_ZONES; i++)
+	{
+		if (EPAPER_Ghost_Over(&EPAPER_Ghost_Table[i], 1))
+			due++;
+	}
+
+	if (quiet && due >= p->full_zones)
+	{
+		EPAPER_Full_Refresh();
+		EPAPER_Ghost_Counters.full++;
+		return EPAPER_GHOST_FULL;
+	}
+
+	for (uint8_t i = 0; i < EPAPER_GHOST_ZONES; i++)
+	{
+		if (!EPAPER_Ghost_Over(&EPAPER_Ghost_Table[i], quiet ? 1 : p->urgent))
+			continue;
+
+		EPAPER_Rect r;
+		EPAPER_Ghost_Zone_Rect(i, &r);
+		EPAPER_Clean_Region(&r);
+		EPAPER_Ghost_Counters.regional++;
+		queued = 1;
+	}
+
+	return queued ? EPAPER_GHOST_REGIONAL : EPAPER_GHOST_NONE;
+}
+
+/**
+ * @brief Counters of every zone, EPAPER_GHOST_ZONES entries row by row
+ */
+const EPAPER_Ghost_Zone *EPAPER_Ghost_Zones(void)
+{
+	return EPAPER_Ghost_Table;
+}
+
+/**
+ * @brief Clean refreshes done since boot
+ */
+const EPAPER_Ghost_Stats *EPAPER_Ghost_Get_Stats(void)
+{
+	return &EPAPER_Ghost_Counters;
+}
@@ -0,0 +1,665 @@
+/*
+ * EPAPER_Glyph.c
+ *
+ *  Generated by tools/gen_glyph.py, do not edit.
+ */
+
+#include "EPAPER_Glyph.h"
+
+static const uint8_t EPAPER_expand_x2[256 * 2] =
+{
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x0F, 0x00, 0x30, 0x00, 0x33, 0x00, 0x3C, 0x00, 0x3F,
+	0x00, 0xC0, 0x00, 0xC3, 0x00, 0xCC, 0x00, 0xCF, 0x00, 0xF0, 0x00, 0xF3, 0x00, 0xFC, 0x00, 0xFF,
+	0x03, 0x00, 0x03, 0x03, 0x03, 0x0C, 0x03, 0x0F, 0x03, 0x30, 0x03, 0x33, 0x03, 0x3C, 0x03, 0x3F,
+	0x03, 0xC0, 0x03, 0xC3, 0x03, 0xCC, 0x03, 0xCF, 0x03, 0xF0, 0x03, 0xF3, 0x03, 0xFC, 0x03, 0xFF,
+	0x0C, 0x00, 0x0C, 0x03, 0x0C, 0x0C, 0x0C, 0x0F, 0x0C, 0x30, 0x0C, 0x33, 0x0C, 0x3C, 0x0C, 0x3F,
+	0x0C, 0xC0, 0x0C, 0xC3, 0x0C, 0xCC, 0x0C, 0xCF, 0x0C, 0xF0, 0x0C, 0xF3, 0x0C, 0xFC, 0x0C, 0xFF,
+	0x0F, 0x00, 0x0F, 0x03, 0x0F, 0x0C, 0x0F, 0x0F, 0x0F, 0x30, 0x0F, 0x33, 0x0F, 0x3C, 0x0F, 0x3F,
+	0x0F, 0xC0, 0x0F, 0xC3, 0x0F, 0xCC, 0x0F, 0xCF, 0x0F, 0xF0, 0x0F, 0xF3, 0x0F, 0xFC, 0x0F, 0xFF,
+	0x30, 0x00, 0x30, 0x03, 0x30, 0x0C, 0x30, 0x0F, 0x30, 0x30, 0x30, 0x33, 0x30, 0x3C, 0x30, 0x3F,
+	0x30, 0xC0, 0x30, 0xC3, 0x30, 0xCC, 0x30, 0xCF, 0x30, 0xF0, 0x30, 0xF3, 0x30, 0xFC, 0x30, 0xFF,
+	0x33, 0x00, 0x33, 0x03, 0x33, 0x0C, 0x33, 0x0F, 0x33, 0x30, 0x33, 0x33, 0x33, 0x3C, 0x33, 0x3F,
+	0x33, 0xC0, 0x33, 0xC3, 0x33, 0xCC, 0x33, 0xCF, 0x33, 0xF0, 0x33, 0xF3, 0x33, 0xFC, 0x33, 0xFF,
+	0x3C, 0x00, 0x3C, 0x03, 0x3C, 0x0C, 0x3C, 0x0F, 0x3C, 0x30, 0x3C, 0x33, 0x3C, 0x3C, 0x3C, 0x3F,
+	0x3C, 0xC0, 0x3C, 0xC3, 0x3C, 0xCC, 0x3C, 0xCF, 0x3C, 0xF0, 0x3C, 0xF3, 0x3C, 0xFC, 0x3C, 0xFF,
+	0x3F, 0x00, 0x3F, 0x03, 0x3F, 0x0C, 0x3F, 0x0F, 0x3F, 0x30, 0x3F, 0x33, 0x3F, 0x3C, 0x3F, 0x3F,
+	0x3F, 0xC0, 0x3F, 0xC3, 0x3F, 0xCC, 0x3F, 0xCF, 0x3F, 0xF0, 0x3F, 0xF3, 0x3F, 0xFC, 0x3F, 0xFF,
+	0xC0, 0x00, 0xC0, 0x03, 0xC0, 0x0C, 0xC0, 0x0F, 0xC0, 0x30, 0xC0, 0x33, 0xC0, 0x3C, 0xC0, 0x3F,
+	0xC0, 0xC0, 0xC0, 0xC3, 0xC0, 0xCC, 0xC0, 0xCF, 0xC0, 0xF0, 0xC0, 0xF3, 0xC0, 0xFC, 0xC0, 0xFF,
+	0xC3, 0x00, 0xC3, 0x03, 0xC3, 0x0C, 0xC3, 0x0F, 0xC3, 0x30, 0xC3, 0x33, 0xC3, 0x3C, 0xC3, 0x3F,
+	0xC3, 0xC0, 0xC3, 0xC3, 0xC3, 0xCC, 0xC3, 0xCF, 0xC3, 0xF0, 0xC3, 0xF3, 0xC3, 0xFC, 0xC3, 0xFF,
+	0xCC, 0x00, 0xCC, 0x03, 0xCC, 0x0C, 0xCC, 0x0F, 0xCC, 0x30, 0xCC, 0x33, 0xCC, 0x3C, 0xCC, 0x3F,
+	0xCC, 0xC0, 0xCC, 0xC3, 0xCC, 0xCC, 0xCC, 0xCF, 0xCC, 0xF0, 0xCC, 0xF3, 0xCC, 0xFC, 0xCC, 0xFF,
+	0xCF, 0x00, 0xCF, 0x03, 0xCF, 0x0C, 0xCF, 0x0F, 0xCF, 0x30, 0xCF, 0x33, 0xCF, 0x3C, 0xCF, 0x3F,
+	0xCF, 0xC0, 0xCF, 0xC3, 0xCF, 0xCC, 0xCF, 0xCF, 0xCF, 0xF0, 0xCF, 0xF3, 0xCF, 0xFC, 0xCF, 0xFF,
+	0xF0, 0x00, 0xF0, 0x03, 0xF0, 0x0C, 0xF0, 0x0F, 0xF0, 0x30, 0xF0, 0x33, 0xF0, 0x3C, 0xF0, 0x3F,
+	0xF0, 0xC0, 0xF0, 0xC3, 0xF0, 0xCC, 0xF0, 0xCF, 0xF0, 0xF0, 0xF0, 0xF3, 0xF0, 0xFC, 0xF0, 0xFF,
+	0xF3, 0x00, 0xF3, 0x03, 0xF3, 0x0C, 0xF3, 0x0F, 0xF3, 0x30, 0xF3, 0x33, 0xF3, 0x3C, 0xF3, 0x3F,
+	0xF3, 0xC0, 0xF3, 0xC3, 0xF3, 0xCC, 0xF3, 0xCF, 0xF3, 0xF0, 0xF3, 0xF3, 0xF3, 0xFC, 0xF3, 0xFF,
+	0xFC, 0x00, 0xFC, 0x03, 0xFC, 0x0C, 0xFC, 0x0F, 0xFC, 0x30, 0xFC, 0x33, 0xFC, 0x3C, 0xFC, 0x3F,
+	0xFC, 0xC0, 0xFC, 0xC3, 0xFC, 0xCC, 0xFC, 0xCF, 0xFC, 0xF0, 0xFC, 0xF3, 0xFC, 0xFC, 0xFC, 0xFF,
+	0xFF, 0x00, 0xFF, 0x03, 0xFF, 0x0C, 0xFF, 0x0F, 0xFF, 0x30, 0xFF, 0x33, 0xFF, 0x3C, 0xFF, 0x3F,
+	0xFF, 0xC0, 0xFF, 0xC3, 0xFF, 0xCC, 0xFF, 0xCF, 0xFF, 0xF0, 0xFF, 0xF3, 0xFF, 0xFC, 0xFF, 0xFF,
+};
+
+static const uint8_t EPAPER_expand_x3[256 * 3] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xC0,
+	0x00, 0x01, 0xC7, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x07,
+	0x00, 0x0E, 0x38, 0x00, 0x0E, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC7, 0x00, 0x0F, 0xF8,
+	0x00, 0x0F, 0xFF, 0x00, 0x70, 0x00, 0x00, 0x70, 0x07, 0x00, 0x70, 0x38, 0x00, 0x70, 0x3F,
+	0x00, 0x71, 0xC0, 0x00, 0x71, 0xC7, 0x00, 0x71, 0xF8, 0x00, 0x71, 0xFF, 0x00, 0x7E, 0x00,
+	0x00, 0x7E, 0x07, 0x00, 0x7E, 0x38, 0x00, 0x7E, 0x3F, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC7,
+	0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xFF, 0x03, 0x80, 0x00, 0x03, 0x80, 0x07, 0x03, 0x80, 0x38,
+	0x03, 0x80, 0x3F, 0x03, 0x81, 0xC0, 0x03, 0x81, 0xC7, 0x03, 0x81, 0xF8, 0x03, 0x81, 0xFF,
+	0x03, 0x8E, 0x00, 0x03, 0x8E, 0x07, 0x03, 0x8E, 0x38, 0x03, 0x8E, 0x3F, 0x03, 0x8F, 0xC0,
+	0x03, 0x8F, 0xC7, 0x03, 0x8F, 0xF8, 0x03, 0x8F, 0xFF, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x07,
+	0x03, 0xF0, 0x38, 0x03, 0xF0, 0x3F, 0x03, 0xF1, 0xC0, 0x03, 0xF1, 0xC7, 0x03, 0xF1, 0xF8,
+	0x03, 0xF1, 0xFF, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x07, 0x03, 0xFE, 0x38, 0x03, 0xFE, 0x3F,
+	0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC7, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x1C, 0x00, 0x00,
+	0x1C, 0x00, 0x07, 0x1C, 0x00, 0x38, 0x1C, 0x00, 0x3F, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC7,
+	0x1C, 0x01, 0xF8, 0x1C, 0x01, 0xFF, 0x1C, 0x0E, 0x00, 0x1C, 0x0E, 0x07, 0x1C, 0x0E, 0x38,
+	0x1C, 0x0E, 0x3F, 0x1C, 0x0F, 0xC0, 0x1C, 0x0F, 0xC7, 0x1C, 0x0F, 0xF8, 0x1C, 0x0F, 0xFF,
+	0x1C, 0x70, 0x00, 0x1C, 0x70, 0x07, 0x1C, 0x70, 0x38, 0x1C, 0x70, 0x3F, 0x1C, 0x71, 0xC0,
+	0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xF8, 0x1C, 0x71, 0xFF, 0x1C, 0x7E, 0x00, 0x1C, 0x7E, 0x07,
+	0x1C, 0x7E, 0x38, 0x1C, 0x7E, 0x3F, 0x1C, 0x7F, 0xC0, 0x1C, 0x7F, 0xC7, 0x1C, 0x7F, 0xF8,
+	0x1C, 0x7F, 0xFF, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x07, 0x1F, 0x80, 0x38, 0x1F, 0x80, 0x3F,
+	0x1F, 0x81, 0xC0, 0x1F, 0x81, 0xC7, 0x1F, 0x81, 0xF8, 0x1F, 0x81, 0xFF, 0x1F, 0x8E, 0x00,
+	0x1F, 0x8E, 0x07, 0x1F, 0x8E, 0x38, 0x1F, 0x8E, 0x3F, 0x1F, 0x8F, 0xC0, 0x1F, 0x8F, 0xC7,
+	0x1F, 0x8F, 0xF8, 0x1F, 0x8F, 0xFF, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0x1F, 0xF0, 0x38,
+	0x1F, 0xF0, 0x3F, 0x1F, 0xF1, 0xC0, 0x1F, 0xF1, 0xC7, 0x1F, 0xF1, 0xF8, 0x1F, 0xF1, 0xFF,
+	0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x07, 0x1F, 0xFE, 0x38, 0x1F, 0xFE, 0x3F, 0x1F, 0xFF, 0xC0,
+	0x1F, 0xFF, 0xC7, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x07,
+	0xE0, 0x00, 0x38, 0xE0, 0x00, 0x3F, 0xE0, 0x01, 0xC0, 0xE0, 0x01, 0xC7, 0xE0, 0x01, 0xF8,
+	0xE0, 0x01, 0xFF, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x07, 0xE0, 0x0E, 0x38, 0xE0, 0x0E, 0x3F,
+	0xE0, 0x0F, 0xC0, 0xE0, 0x0F, 0xC7, 0xE0, 0x0F, 0xF8, 0xE0, 0x0F, 0xFF, 0xE0, 0x70, 0x00,
+	0xE0, 0x70, 0x07, 0xE0, 0x70, 0x38, 0xE0, 0x70, 0x3F, 0xE0, 0x71, 0xC0, 0xE0, 0x71, 0xC7,
+	0xE0, 0x71, 0xF8, 0xE0, 0x71, 0xFF, 0xE0, 0x7E, 0x00, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x38,
+	0xE0, 0x7E, 0x3F, 0xE0, 0x7F, 0xC0, 0xE0, 0x7F, 0xC7, 0xE0, 0x7F, 0xF8, 0xE0, 0x7F, 0xFF,
+	0xE3, 0x80, 0x00, 0xE3, 0x80, 0x07, 0xE3, 0x80, 0x38, 0xE3, 0x80, 0x3F, 0xE3, 0x81, 0xC0,
+	0xE3, 0x81, 0xC7, 0xE3, 0x81, 0xF8, 0xE3, 0x81, 0xFF, 0xE3, 0x8E, 0x00, 0xE3, 0x8E, 0x07,
+	0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x3F, 0xE3, 0x8F, 0xC0, 0xE3, 0x8F, 0xC7, 0xE3, 0x8F, 0xF8,
+	0xE3, 0x8F, 0xFF, 0xE3, 0xF0, 0x00, 0xE3, 0xF0, 0x07, 0xE3, 0xF0, 0x38, 0xE3, 0xF0, 0x3F,
+	0xE3, 0xF1, 0xC0, 0xE3, 0xF1, 0xC7, 0xE3, 0xF1, 0xF8, 0xE3, 0xF1, 0xFF, 0xE3, 0xFE, 0x00,
+	0xE3, 0xFE, 0x07, 0xE3, 0xFE, 0x38, 0xE3, 0xFE, 0x3F, 0xE3, 0xFF, 0xC0, 0xE3, 0xFF, 0xC7,
+	0xE3, 0xFF, 0xF8, 0xE3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x38,
+	0xFC, 0x00, 0x3F, 0xFC, 0x01, 0xC0, 0xFC, 0x01, 0xC7, 0xFC, 0x01, 0xF8, 0xFC, 0x01, 0xFF,
+	0xFC, 0x0E, 0x00, 0xFC, 0x0E, 0x07, 0xFC, 0x0E, 0x38, 0xFC, 0x0E, 0x3F, 0xFC, 0x0F, 0xC0,
+	0xFC, 0x0F, 0xC7, 0xFC, 0x0F, 0xF8, 0xFC, 0x0F, 0xFF, 0xFC, 0x70, 0x00, 0xFC, 0x70, 0x07,
+	0xFC, 0x70, 0x38, 0xFC, 0x70, 0x3F, 0xFC, 0x71, 0xC0, 0xFC, 0x71, 0xC7, 0xFC, 0x71, 0xF8,
+	0xFC, 0x71, 0xFF, 0xFC, 0x7E, 0x00, 0xFC, 0x7E, 0x07, 0xFC, 0x7E, 0x38, 0xFC, 0x7E, 0x3F,
+	0xFC, 0x7F, 0xC0, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xF8, 0xFC, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
+	0xFF, 0x80, 0x07, 0xFF, 0x80, 0x38, 0xFF, 0x80, 0x3F, 0xFF, 0x81, 0xC0, 0xFF, 0x81, 0xC7,
+	0xFF, 0x81, 0xF8, 0xFF, 0x81, 0xFF, 0xFF, 0x8E, 0x00, 0xFF, 0x8E, 0x07, 0xFF, 0x8E, 0x38,
+	0xFF, 0x8E, 0x3F, 0xFF, 0x8F, 0xC0, 0xFF, 0x8F, 0xC7, 0xFF, 0x8F, 0xF8, 0xFF, 0x8F, 0xFF,
+	0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0xF0, 0x38, 0xFF, 0xF0, 0x3F, 0xFF, 0xF1, 0xC0,
+	0xFF, 0xF1, 0xC7, 0xFF, 0xF1, 0xF8, 0xFF, 0xF1, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x07,
+	0xFF, 0xFE, 0x38, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8,
+	0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t EPAPER_expand_x4[256 * 4] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
+	0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0xFF,
+	0x00, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xFF,
+	0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0x00, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0xF0, 0xFF,
+	0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x0F, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
+	0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF,
+	0x00, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0x0F, 0xF0, 0x00, 0xF0, 0x0F, 0xFF,
+	0x00, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x0F, 0x00, 0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0xFF,
+	0x00, 0xF0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0xF0, 0x00, 0xF0, 0xFF, 0xFF,
+	0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x0F, 0x00, 0x00, 0xFF, 0x0F, 0x0F, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0xFF,
+	0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0x00, 0xFF, 0xF0, 0xF0, 0x00, 0xFF, 0xF0, 0xFF,
+	0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
+	0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFF,
+	0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0xF0, 0x0F, 0x00, 0x0F, 0xFF,
+	0x0F, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0xF0, 0x0F, 0x00, 0xF0, 0xFF,
+	0x0F, 0x00, 0xFF, 0x00, 0x0F, 0x00, 0xFF, 0x0F, 0x0F, 0x00, 0xFF, 0xF0, 0x0F, 0x00, 0xFF, 0xFF,
+	0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0xF0, 0x0F, 0x0F, 0x00, 0xFF,
+	0x0F, 0x0F, 0x0F, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xF0, 0x0F, 0x0F, 0x0F, 0xFF,
+	0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x0F, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0, 0xFF,
+	0x0F, 0x0F, 0xFF, 0x00, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0xF0, 0x0F, 0x0F, 0xFF, 0xFF,
+	0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0xF0, 0x0F, 0xF0, 0x00, 0xFF,
+	0x0F, 0xF0, 0x0F, 0x00, 0x0F, 0xF0, 0x0F, 0x0F, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFF,
+	0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0xF0, 0x0F, 0xF0, 0xF0, 0xFF,
+	0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x0F, 0x0F, 0xF0, 0xFF, 0xF0, 0x0F, 0xF0, 0xFF, 0xFF,
+	0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0x0F, 0xFF, 0x00, 0xF0, 0x0F, 0xFF, 0x00, 0xFF,
+	0x0F, 0xFF, 0x0F, 0x00, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0xF0, 0x0F, 0xFF, 0x0F, 0xFF,
+	0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0x0F, 0xFF, 0xF0, 0xF0, 0x0F, 0xFF, 0xF0, 0xFF,
+	0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF,
+	0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0xFF,
+	0xF0, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x0F, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0xF0, 0x00, 0x0F, 0xFF,
+	0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0xF0, 0x00, 0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0xFF,
+	0xF0, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0xF0, 0xF0, 0x00, 0xFF, 0xFF,
+	0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0xF0, 0x0F, 0x00, 0xF0, 0xF0, 0x0F, 0x00, 0xFF,
+	0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0x0F, 0x0F, 0x0F, 0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xFF,
+	0xF0, 0x0F, 0xF0, 0x00, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0xF0, 0xF0, 0x0F, 0xF0, 0xFF,
+	0xF0, 0x0F, 0xFF, 0x00, 0xF0, 0x0F, 0xFF, 0x0F, 0xF0, 0x0F, 0xFF, 0xF0, 0xF0, 0x0F, 0xFF, 0xFF,
+	0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x0F, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0xF0, 0x00, 0xFF,
+	0xF0, 0xF0, 0x0F, 0x00, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0xF0, 0xF0, 0xF0, 0x0F, 0xFF,
+	0xF0, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0xF0, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF,
+	0xF0, 0xF0, 0xFF, 0x00, 0xF0, 0xF0, 0xFF, 0x0F, 0xF0, 0xF0, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF,
+	0xF0, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0xF0, 0xF0, 0xFF, 0x00, 0xFF,
+	0xF0, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xF0, 0xFF, 0x0F, 0xFF,
+	0xF0, 0xFF, 0xF0, 0x00, 0xF0, 0xFF, 0xF0, 0x0F, 0xF0, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xF0, 0xFF,
+	0xF0, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0x0F, 0x00, 0xFF, 0x00, 0x0F, 0x0F, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xFF,
+	0xFF, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0xFF, 0x00, 0xF0, 0xF0, 0xFF, 0x00, 0xF0, 0xFF,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x0F, 0xFF, 0x00, 0xFF, 0xF0, 0xFF, 0x00, 0xFF, 0xFF,
+	0xFF, 0x0F, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x0F, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0xFF,
+	0xFF, 0x0F, 0x0F, 0x00, 0xFF, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0xF0, 0xFF, 0x0F, 0x0F, 0xFF,
+	0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xFF, 0x0F, 0xF0, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
+	0xFF, 0x0F, 0xFF, 0x00, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0x0F, 0xFF, 0xFF,
+	0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xF0, 0xFF, 0xF0, 0x00, 0xFF,
+	0xFF, 0xF0, 0x0F, 0x00, 0xFF, 0xF0, 0x0F, 0x0F, 0xFF, 0xF0, 0x0F, 0xF0, 0xFF, 0xF0, 0x0F, 0xFF,
+	0xFF, 0xF0, 0xF0, 0x00, 0xFF, 0xF0, 0xF0, 0x0F, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xF0, 0xF0, 0xFF,
+	0xFF, 0xF0, 0xFF, 0x00, 0xFF, 0xF0, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xFF, 0x00, 0xFF,
+	0xFF, 0xFF, 0x0F, 0x00, 0xFF, 0xFF, 0x0F, 0x0F, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0x0F, 0xFF,
+	0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t EPAPER_expand_x5[256 * 5] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xE0,
+	0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x1F,
+	0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0F, 0x80, 0x00,
+	0x00, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x00, 0x0F, 0x83, 0xFF,
+	0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x1F, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
+	0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x1F,
+	0x00, 0x01, 0xF0, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x01, 0xF0, 0x7C, 0x00,
+	0x00, 0x01, 0xF0, 0x7C, 0x1F, 0x00, 0x01, 0xF0, 0x7F, 0xE0, 0x00, 0x01, 0xF0, 0x7F, 0xFF,
+	0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0x00, 0x01, 0xFF, 0x83, 0xE0,
+	0x00, 0x01, 0xFF, 0x83, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x1F,
+	0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x00, 0x00,
+	0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xFF,
+	0x00, 0x3E, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x00, 0x7F, 0xE0,
+	0x00, 0x3E, 0x00, 0x7F, 0xFF, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x1F,
+	0x00, 0x3E, 0x0F, 0x83, 0xE0, 0x00, 0x3E, 0x0F, 0x83, 0xFF, 0x00, 0x3E, 0x0F, 0xFC, 0x00,
+	0x00, 0x3E, 0x0F, 0xFC, 0x1F, 0x00, 0x3E, 0x0F, 0xFF, 0xE0, 0x00, 0x3E, 0x0F, 0xFF, 0xFF,
+	0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0x00, 0x3F, 0xF0, 0x03, 0xE0,
+	0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x7C, 0x00, 0x00, 0x3F, 0xF0, 0x7C, 0x1F,
+	0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x00,
+	0x00, 0x3F, 0xFF, 0x80, 0x1F, 0x00, 0x3F, 0xFF, 0x83, 0xE0, 0x00, 0x3F, 0xFF, 0x83, 0xFF,
+	0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x1F, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
+	0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F,
+	0x07, 0xC0, 0x00, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x07, 0xC0, 0x00, 0x7C, 0x00,
+	0x07, 0xC0, 0x00, 0x7C, 0x1F, 0x07, 0xC0, 0x00, 0x7F, 0xE0, 0x07, 0xC0, 0x00, 0x7F, 0xFF,
+	0x07, 0xC0, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x07, 0xC0, 0x0F, 0x83, 0xE0,
+	0x07, 0xC0, 0x0F, 0x83, 0xFF, 0x07, 0xC0, 0x0F, 0xFC, 0x00, 0x07, 0xC0, 0x0F, 0xFC, 0x1F,
+	0x07, 0xC0, 0x0F, 0xFF, 0xE0, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0x07, 0xC1, 0xF0, 0x00, 0x00,
+	0x07, 0xC1, 0xF0, 0x00, 0x1F, 0x07, 0xC1, 0xF0, 0x03, 0xE0, 0x07, 0xC1, 0xF0, 0x03, 0xFF,
+	0x07, 0xC1, 0xF0, 0x7C, 0x00, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7F, 0xE0,
+	0x07, 0xC1, 0xF0, 0x7F, 0xFF, 0x07, 0xC1, 0xFF, 0x80, 0x00, 0x07, 0xC1, 0xFF, 0x80, 0x1F,
+	0x07, 0xC1, 0xFF, 0x83, 0xE0, 0x07, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xC1, 0xFF, 0xFC, 0x00,
+	0x07, 0xC1, 0xFF, 0xFC, 0x1F, 0x07, 0xC1, 0xFF, 0xFF, 0xE0, 0x07, 0xC1, 0xFF, 0xFF, 0xFF,
+	0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0x07, 0xFE, 0x00, 0x03, 0xE0,
+	0x07, 0xFE, 0x00, 0x03, 0xFF, 0x07, 0xFE, 0x00, 0x7C, 0x00, 0x07, 0xFE, 0x00, 0x7C, 0x1F,
+	0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xFF, 0x07, 0xFE, 0x0F, 0x80, 0x00,
+	0x07, 0xFE, 0x0F, 0x80, 0x1F, 0x07, 0xFE, 0x0F, 0x83, 0xE0, 0x07, 0xFE, 0x0F, 0x83, 0xFF,
+	0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0x07, 0xFE, 0x0F, 0xFF, 0xE0,
+	0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x1F,
+	0x07, 0xFF, 0xF0, 0x03, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0x07, 0xFF, 0xF0, 0x7C, 0x00,
+	0x07, 0xFF, 0xF0, 0x7C, 0x1F, 0x07, 0xFF, 0xF0, 0x7F, 0xE0, 0x07, 0xFF, 0xF0, 0x7F, 0xFF,
+	0x07, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x1F, 0x07, 0xFF, 0xFF, 0x83, 0xE0,
+	0x07, 0xFF, 0xFF, 0x83, 0xFF, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x1F,
+	0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x03, 0xFF,
+	0xF8, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xE0,
+	0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x1F,
+	0xF8, 0x00, 0x0F, 0x83, 0xE0, 0xF8, 0x00, 0x0F, 0x83, 0xFF, 0xF8, 0x00, 0x0F, 0xFC, 0x00,
+	0xF8, 0x00, 0x0F, 0xFC, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0xF8, 0x00, 0x0F, 0xFF, 0xFF,
+	0xF8, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x1F, 0xF8, 0x01, 0xF0, 0x03, 0xE0,
+	0xF8, 0x01, 0xF0, 0x03, 0xFF, 0xF8, 0x01, 0xF0, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x7C, 0x1F,
+	0xF8, 0x01, 0xF0, 0x7F, 0xE0, 0xF8, 0x01, 0xF0, 0x7F, 0xFF, 0xF8, 0x01, 0xFF, 0x80, 0x00,
+	0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x83, 0xE0, 0xF8, 0x01, 0xFF, 0x83, 0xFF,
+	0xF8, 0x01, 0xFF, 0xFC, 0x00, 0xF8, 0x01, 0xFF, 0xFC, 0x1F, 0xF8, 0x01, 0xFF, 0xFF, 0xE0,
+	0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x00, 0x1F,
+	0xF8, 0x3E, 0x00, 0x03, 0xE0, 0xF8, 0x3E, 0x00, 0x03, 0xFF, 0xF8, 0x3E, 0x00, 0x7C, 0x00,
+	0xF8, 0x3E, 0x00, 0x7C, 0x1F, 0xF8, 0x3E, 0x00, 0x7F, 0xE0, 0xF8, 0x3E, 0x00, 0x7F, 0xFF,
+	0xF8, 0x3E, 0x0F, 0x80, 0x00, 0xF8, 0x3E, 0x0F, 0x80, 0x1F, 0xF8, 0x3E, 0x0F, 0x83, 0xE0,
+	0xF8, 0x3E, 0x0F, 0x83, 0xFF, 0xF8, 0x3E, 0x0F, 0xFC, 0x00, 0xF8, 0x3E, 0x0F, 0xFC, 0x1F,
+	0xF8, 0x3E, 0x0F, 0xFF, 0xE0, 0xF8, 0x3E, 0x0F, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x00, 0x00,
+	0xF8, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x03, 0xE0, 0xF8, 0x3F, 0xF0, 0x03, 0xFF,
+	0xF8, 0x3F, 0xF0, 0x7C, 0x00, 0xF8, 0x3F, 0xF0, 0x7C, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0,
+	0xF8, 0x3F, 0xF0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0x80, 0x00, 0xF8, 0x3F, 0xFF, 0x80, 0x1F,
+	0xF8, 0x3F, 0xFF, 0x83, 0xE0, 0xF8, 0x3F, 0xFF, 0x83, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x00,
+	0xF8, 0x3F, 0xFF, 0xFC, 0x1F, 0xF8, 0x3F, 0xFF, 0xFF, 0xE0, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xE0,
+	0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7C, 0x00, 0xFF, 0xC0, 0x00, 0x7C, 0x1F,
+	0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0x80, 0x00,
+	0xFF, 0xC0, 0x0F, 0x80, 0x1F, 0xFF, 0xC0, 0x0F, 0x83, 0xE0, 0xFF, 0xC0, 0x0F, 0x83, 0xFF,
+	0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0,
+	0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC1, 0xF0, 0x00, 0x00, 0xFF, 0xC1, 0xF0, 0x00, 0x1F,
+	0xFF, 0xC1, 0xF0, 0x03, 0xE0, 0xFF, 0xC1, 0xF0, 0x03, 0xFF, 0xFF, 0xC1, 0xF0, 0x7C, 0x00,
+	0xFF, 0xC1, 0xF0, 0x7C, 0x1F, 0xFF, 0xC1, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xF0, 0x7F, 0xFF,
+	0xFF, 0xC1, 0xFF, 0x80, 0x00, 0xFF, 0xC1, 0xFF, 0x80, 0x1F, 0xFF, 0xC1, 0xFF, 0x83, 0xE0,
+	0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F,
+	0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+	0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xE0, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
+	0xFF, 0xFE, 0x00, 0x7C, 0x00, 0xFF, 0xFE, 0x00, 0x7C, 0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xE0,
+	0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x0F, 0x80, 0x00, 0xFF, 0xFE, 0x0F, 0x80, 0x1F,
+	0xFF, 0xFE, 0x0F, 0x83, 0xE0, 0xFF, 0xFE, 0x0F, 0x83, 0xFF, 0xFF, 0xFE, 0x0F, 0xFC, 0x00,
+	0xFF, 0xFE, 0x0F, 0xFC, 0x1F, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xE0,
+	0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x7C, 0x00, 0xFF, 0xFF, 0xF0, 0x7C, 0x1F,
+	0xFF, 0xFF, 0xF0, 0x7F, 0xE0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+	0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0x83, 0xE0, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t EPAPER_expand_x6[256 * 6] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+	0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F,
+	0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F,
+	0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xFF,
+	0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x3F,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+	0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xFF,
+	0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x3F,
+	0x00, 0x00, 0x3F, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x03, 0xFF, 0xFF,
+	0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x3F,
+	0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFF,
+	0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F,
+	0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+	0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
+	0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFF,
+	0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x3F,
+	0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xFF,
+	0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x3F,
+	0x00, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x0F, 0xFF,
+	0x00, 0x0F, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0xF0, 0x3F,
+	0x00, 0x0F, 0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF,
+	0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F,
+	0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF,
+	0x00, 0x0F, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xF0, 0x3F,
+	0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xFF,
+	0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F,
+	0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF,
+	0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F,
+	0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F,
+	0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
+	0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F,
+	0x03, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
+	0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
+	0x03, 0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x0F, 0xFF,
+	0x03, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0xF0, 0x3F,
+	0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
+	0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F,
+	0x03, 0xF0, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0x00, 0x0F, 0xFF,
+	0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F,
+	0x03, 0xF0, 0x3F, 0x03, 0xFF, 0xC0, 0x03, 0xF0, 0x3F, 0x03, 0xFF, 0xFF,
+	0x03, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0xFC, 0x00, 0x3F,
+	0x03, 0xF0, 0x3F, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0xFC, 0x0F, 0xFF,
+	0x03, 0xF0, 0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F,
+	0x03, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF,
+	0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
+	0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
+	0x03, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xF0, 0x3F,
+	0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
+	0x03, 0xFF, 0xC0, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xFC, 0x00, 0x3F,
+	0x03, 0xFF, 0xC0, 0xFC, 0x0F, 0xC0, 0x03, 0xFF, 0xC0, 0xFC, 0x0F, 0xFF,
+	0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x3F,
+	0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+	0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
+	0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+	0x03, 0xFF, 0xFF, 0x03, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xF0, 0x3F,
+	0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+	0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
+	0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
+	0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F,
+	0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
+	0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+	0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x3F,
+	0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+	0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3F,
+	0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xFF,
+	0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x3F,
+	0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3F,
+	0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xFF,
+	0xFC, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x03, 0xF0, 0x3F,
+	0xFC, 0x00, 0x3F, 0x03, 0xFF, 0xC0, 0xFC, 0x00, 0x3F, 0x03, 0xFF, 0xFF,
+	0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F,
+	0xFC, 0x00, 0x3F, 0xFC, 0x0F, 0xC0, 0xFC, 0x00, 0x3F, 0xFC, 0x0F, 0xFF,
+	0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x3F,
+	0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+	0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
+	0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xFF,
+	0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x3F,
+	0xFC, 0x0F, 0xC0, 0x03, 0xFF, 0xC0, 0xFC, 0x0F, 0xC0, 0x03, 0xFF, 0xFF,
+	0xFC, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0xFC, 0x00, 0x3F,
+	0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xFF,
+	0xFC, 0x0F, 0xC0, 0xFF, 0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0xF0, 0x3F,
+	0xFC, 0x0F, 0xC0, 0xFF, 0xFF, 0xC0, 0xFC, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF,
+	0xFC, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xFF, 0x00, 0x00, 0x3F,
+	0xFC, 0x0F, 0xFF, 0x00, 0x0F, 0xC0, 0xFC, 0x0F, 0xFF, 0x00, 0x0F, 0xFF,
+	0xFC, 0x0F, 0xFF, 0x03, 0xF0, 0x00, 0xFC, 0x0F, 0xFF, 0x03, 0xF0, 0x3F,
+	0xFC, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0xFC, 0x0F, 0xFF, 0x03, 0xFF, 0xFF,
+	0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0x3F,
+	0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF,
+	0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F,
+	0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
+	0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
+	0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xF0, 0x3F,
+	0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
+	0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
+	0xFF, 0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0xFF, 0xF0, 0x00, 0xFC, 0x0F, 0xFF,
+	0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x3F,
+	0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x3F,
+	0xFF, 0xF0, 0x3F, 0x00, 0x0F, 0xC0, 0xFF, 0xF0, 0x3F, 0x00, 0x0F, 0xFF,
+	0xFF, 0xF0, 0x3F, 0x03, 0xF0, 0x00, 0xFF, 0xF0, 0x3F, 0x03, 0xF0, 0x3F,
+	0xFF, 0xF0, 0x3F, 0x03, 0xFF, 0xC0, 0xFF, 0xF0, 0x3F, 0x03, 0xFF, 0xFF,
+	0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xFC, 0x00, 0x3F,
+	0xFF, 0xF0, 0x3F, 0xFC, 0x0F, 0xC0, 0xFF, 0xF0, 0x3F, 0xFC, 0x0F, 0xFF,
+	0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F,
+	0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
+	0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
+	0xFF, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xF0, 0x3F,
+	0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x3F,
+	0xFF, 0xFF, 0xC0, 0xFC, 0x0F, 0xC0, 0xFF, 0xFF, 0xC0, 0xFC, 0x0F, 0xFF,
+	0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xF0, 0x3F,
+	0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
+	0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0x3F,
+	0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
+	0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t EPAPER_expand_x7[256 * 7] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7F,
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7F,
+	0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xFF,
+	0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x7F,
+	0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F,
+	0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xFF,
+	0x00, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x7F,
+	0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0xFF,
+	0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
+	0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFF,
+	0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x7F,
+	0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F,
+	0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
+	0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x7F,
+	0x00, 0x03, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
+	0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x7F,
+	0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0xFF,
+	0x00, 0x03, 0xF8, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F,
+	0x00, 0x03, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
+	0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
+	0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
+	0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xC0, 0x7F,
+	0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
+	0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+	0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
+	0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+	0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
+	0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+	0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x7F,
+	0x01, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+	0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F,
+	0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0xFF,
+	0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x7F,
+	0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+	0x01, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x7F,
+	0x01, 0xFC, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x3F, 0xFF,
+	0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F,
+	0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xFF, 0x80, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xFF, 0xFF,
+	0x01, 0xFC, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
+	0x01, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0x80, 0x01, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xFF,
+	0x01, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x7F,
+	0x01, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F,
+	0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
+	0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xC0, 0x7F,
+	0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
+	0x01, 0xFF, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x0F, 0xE0, 0x00, 0x7F,
+	0x01, 0xFF, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0x01, 0xFF, 0xF8, 0x0F, 0xE0, 0x3F, 0xFF,
+	0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F,
+	0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
+	0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
+	0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
+	0x01, 0xFF, 0xFF, 0xF0, 0x1F, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x1F, 0xC0, 0x7F,
+	0x01, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
+	0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+	0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
+	0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+	0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+	0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+	0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7F,
+	0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+	0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7F,
+	0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xFF,
+	0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x7F,
+	0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+	0xFE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F,
+	0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xFF,
+	0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x7F,
+	0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0x80, 0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xFF, 0xFF,
+	0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
+	0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0x80, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFF,
+	0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x7F,
+	0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFE, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F,
+	0xFE, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
+	0xFE, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x7F,
+	0xFE, 0x03, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0xFE, 0x03, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
+	0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x7F,
+	0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0xFF,
+	0xFE, 0x03, 0xF8, 0x0F, 0xFF, 0xC0, 0x00, 0xFE, 0x03, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F,
+	0xFE, 0x03, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
+	0xFE, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
+	0xFE, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0xFE, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
+	0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xC0, 0x00, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xC0, 0x7F,
+	0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
+	0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+	0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
+	0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+	0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
+	0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+	0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x7F,
+	0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+	0xFF, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F,
+	0xFF, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0xFF, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0xFF,
+	0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x7F,
+	0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x7F,
+	0xFF, 0xFC, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0xFF, 0xFC, 0x07, 0xF0, 0x00, 0x3F, 0xFF,
+	0xFF, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0xFF, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F,
+	0xFF, 0xFC, 0x07, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xF0, 0x1F, 0xFF, 0xFF,
+	0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
+	0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xFF,
+	0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x7F,
+	0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F,
+	0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
+	0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xC0, 0x7F,
+	0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x00, 0x7F,
+	0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x3F, 0xFF,
+	0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F,
+	0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
+	0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xC0, 0x7F,
+	0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const uint8_t EPAPER_expand_x8[256 * 8] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+	0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+	0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+	0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+	0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
+	0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+	0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+	0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+	0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+	0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+const uint8_t * const EPAPER_expand[EPAPER_EXPAND_MAX + 1] =
+{
+	0, 0,
+	EPAPER_expand_x2,
+	EPAPER_expand_x3,
+	EPAPER_expand_x4,
+	EPAPER_expand_x5,
+	EPAPER_expand_x6,
+	EPAPER_expand_x7,
+	EPAPER_expand_x8,
+};
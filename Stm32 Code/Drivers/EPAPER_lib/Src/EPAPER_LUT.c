@@ -0,0 +1,172 @@
+
+
+#include "EPAPER_LUT.h"
+//
+
+/*
+ * Each 7 byte line is one waveform group, bytes 1 to 4 are the phases:
+ * bits 7-6 select the drive level (00 none, 01 black, 10 white), bits 5-0
+ * the number of frames. The last driven phase sets the colour left.
+ */
+
+/**
+ * direct update LUT: half length, ww and bb are not driven
+**/
+static const uint8_t EPAPER_lut_fast_vcom[EPAPER_LUT_SIZE] = {
+	0x01, 0x0A, 0x05, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+static const uint8_t EPAPER_lut_fast_ww[EPAPER_LUT_SIZE] = {
+	0x01, 0x0A, 0x05, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+static const uint8_t EPAPER_lut_fast_bw[EPAPER_LUT_SIZE] = {
+	0x01, 0x8A, 0x05, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+static const uint8_t EPAPER_lut_fast_wb[EPAPER_LUT_SIZE] = {
+	0x01, 0x4A, 0x45, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+static const uint8_t EPAPER_lut_fast_bb[EPAPER_LUT_SIZE] = {
+	0x01, 0x0A, 0x05, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+/**
+ * partial update LUT (the original tables)
+**/
+static const uint8_t EPAPER_lut_partial_vcom[EPAPER_LUT_SIZE] = {
+	0x01, 0x14, 0x0A, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+static const uint8_t EPAPER_lut_partial_ww[EPAPER_LUT_SIZE] = {
+	0x01, 0x14, 0x0A, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+static const uint8_t EPAPER_lut_partial_bw[EPAPER_LUT_SIZE] = {
+	0x01, 0x94, 0x0A, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+static const uint8_t EPAPER_lut_partial_wb[EPAPER_LUT_SIZE] = {
+	0x01, 0x54, 0x4A, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+static const uint8_t EPAPER_lut_partial_bb[EPAPER_LUT_SIZE] = {
+	0x01, 0x54, 0x4A, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+/**
+ * full clear LUT: double length, every pixel is driven. Pixels that keep
+ * their colour are shaken to the other one and back (ww black then white,
+ * bb white then black), the others get one long drive to their new colour
+**/
+static const uint8_t EPAPER_lut_full_vcom[EPAPER_LUT_SIZE] = {
+	0x01, 0x28, 0x14, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+static const uint8_t EPAPER_lut_full_ww[EPAPER_LUT_SIZE] = {
+	0x01, 0x68, 0x94, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+static const uint8_t EPAPER_lut_full_bw[EPAPER_LUT_SIZE] = {
+	0x01, 0xA8, 0x14, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+static const uint8_t EPAPER_lut_full_wb[EPAPER_LUT_SIZE] = {
+	0x01, 0x68, 0x54, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+static const uint8_t EPAPER_lut_full_bb[EPAPER_LUT_SIZE] = {
+	0x01, 0xA8, 0x54, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+const EPAPER_LUT_Set EPAPER_lut_set[EPAPER_LUT_COUNT] = {
+	{EPAPER_lut_fast_vcom, EPAPER_lut_fast_ww, EPAPER_lut_fast_bw, EPAPER_lut_fast_wb, EPAPER_lut_fast_bb},
+	{EPAPER_lut_partial_vcom, EPAPER_lut_partial_ww, EPAPER_lut_partial_bw, EPAPER_lut_partial_wb, EPAPER_lut_partial_bb},
+	{EPAPER_lut_full_vcom, EPAPER_lut_full_ww, EPAPER_lut_full_bw, EPAPER_lut_full_wb, EPAPER_lut_full_bb},
+};
+
+/**
+ * temperature bands, colder ink moves slower and needs longer phases
+**/
+const EPAPER_LUT_Band EPAPER_lut_band[EPAPER_LUT_BANDS] = {
+	{-400, 32},    // below 5 °C      x2
+	{  50, 24},    // 5 to 15 °C      x1.5
+	{ 150, 16},    // 15 to 30 °C     x1
+	{ 300, 12},    // above 30 °C     x0.75
+};
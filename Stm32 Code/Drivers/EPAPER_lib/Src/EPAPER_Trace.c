@@ -0,0 +1,183 @@
+/*
+ * EPAPER_Trace.c
+ *
+ *  In-RAM recorder of the panel command stream, see EPAPER_Trace.h
+ */
+
+#include "EPAPER_Trace.h"
+
+#if EPAPER_TRACE
+
+#include "DRIVER.h"
+
+static EPAPER_Trace_Record EPAPER_Trace_Buffer[EPAPER_TRACE_RECORDS];
+static uint16_t EPAPER_Trace_Head = 0;         // next record written
+static uint16_t EPAPER_Trace_Count = 0;
+static uint32_t EPAPER_Trace_Dropped = 0;      // records overwritten
+
+static EPAPER_Trace_Tag EPAPER_Trace_Current = EPAPER_TAG_OTHER;
+
+/* command being sent, its data bytes are added to its record */
+static EPAPER_Trace_Record *EPAPER_Trace_Last = NULL;
+static uint32_t EPAPER_Trace_Last_Tick = 0;
+static uint8_t EPAPER_Trace_Last_Cmd = 0;
+static uint8_t EPAPER_Trace_Param[6];         // first data bytes, for the 0x90 window
+
+/**
+ * @brief Take the next record, the BUSY interrupt appends too
+ */
+static EPAPER_Trace_Record *EPAPER_Trace_Append(uint8_t type, uint8_t cmd, uint16_t arg, uint32_t value)
+{
+	uint32_t primask = __get_PRIMASK();
+	EPAPER_Trace_Record *r;
+
+	__disable_irq();
+	r = &EPAPER_Trace_Buffer[EPAPER_Trace_Head];
+	EPAPER_Trace_Head = (EPAPER_Trace_Head + 1) % EPAPER_TRACE_RECORDS;
+	if (EPAPER_Trace_Count < EPAPER_TRACE_RECORDS)
+		EPAPER_Trace_Count++;
+	else
+		EPAPER_Trace_Dropped++;
+	if (r == EPAPER_Trace_Last)
+		EPAPER_Trace_Last = NULL;
+
+	r->type = type;
+	r->cmd = cmd;
+	r->arg = arg;
+	r->value = value;
+	__set_PRIMASK(primask);
+	return r;
+}
+
+/**
+ * @brief Command byte, from EPAPER_SendCommand
+ */
+void EPAPER_Trace_Command(uint8_t cmd)
+{
+	EPAPER_Trace_Last = EPAPER_Trace_Append(EPAPER_TRACE_COMMAND, cmd, 0, 0);
+	EPAPER_Trace_Last_Tick = HAL_GetTick();
+	EPAPER_Trace_Last_Cmd = cmd;
+}
+
+/**
+ * @brief Data bytes of the current command, once they are sent
+ * @param data Bytes sent, NULL for a fill
+ * @param len Byte count
+ */
+void EPAPER_Trace_Data(const uint8_t *data, uint32_t len)
+{
+	EPAPER_Trace_Record *r = EPAPER_Trace_Last;
+	uint16_t sent;
+
+	if (r == NULL)
+		return;
+
+	sent = r->arg;
+	r->arg = (sent + len > UINT16_MAX) ? UINT16_MAX : sent + len;
+	r->value = HAL_GetTick() - EPAPER_Trace_Last_Tick;
+
+	/* keep the window parameters, the record is written with the last one */
+	if (r->cmd != 0x90 || sent >= sizeof(EPAPER_Trace_Param))
+		return;
+	for (uint32_t i = 0; i < len && sent + i < sizeof(EPAPER_Trace_Param); i++)
+		EPAPER_Trace_Param[sent + i] = data != NULL ? data[i] : 0;
+	if (sent + len >= sizeof(EPAPER_Trace_Param))
+	{
+		const uint8_t *p = EPAPER_Trace_Param;
+		uint16_t width = (p[1] | 0x07) - (p[0] & 0xF8) + 1;
+		uint16_t height = ((p[4] << 8) | p[5]) - ((p[2] << 8) | p[3]) + 1;
+
+		EPAPER_Trace_Append(EPAPER_TRACE_WINDOW, 0x90, 0, ((uint32_t)width << 16) | height);
+		EPAPER_Trace_Last = r;
+	}
+}
+
+/**
+ * @brief End of a BUSY phase, from the BUSY interrupt
+ * @param ms Measured duration
+ */
+void EPAPER_Trace_Busy(uint32_t ms)
+{
+	EPAPER_Trace_Append(EPAPER_TRACE_BUSY, EPAPER_Trace_Last_Cmd, 0, ms);
+}
+
+/**
+ * @brief Start of a logical update (flush, clear, red refresh)
+ */
+void EPAPER_Trace_Update(void)
+{
+	EPAPER_Trace_Append(EPAPER_TRACE_UPDATE, 0, 0, HAL_GetTick());
+	EPAPER_Trace_Last = NULL;
+}
+
+/**
+ * @brief Following commands belong to a new section of the update
+ * @param kind What the section sends
+ * @param tags Drawing calls it comes from, one bit per EPAPER_Trace_Tag
+ */
+void EPAPER_Trace_Section(EPAPER_Trace_Section_Kind kind, uint16_t tags)
+{
+	EPAPER_Trace_Append(EPAPER_TRACE_SECTION, kind, tags, HAL_GetTick());
+	EPAPER_Trace_Last = NULL;
+}
+
+/**
+ * @brief Drawing call the next frame buffer changes come from
+ */
+void EPAPER_Trace_Set_Tag(EPAPER_Trace_Tag tag)
+{
+	EPAPER_Trace_Current = tag;
+}
+
+/**
+ * @brief Tag bit of the current drawing call
+ */
+uint16_t EPAPER_Trace_Tags(void)
+{
+	return 1U << EPAPER_Trace_Current;
+}
+
+/**
+ * @brief Write the trace as text, oldest record first
+ * @param write Output, called once per line
+ *
+ * Format read by tools/trace_decode.py:
+ *   EPAPER_TRACE <records> <dropped>
+ *   <type> <cmd hex> <arg hex> <value>     one line per record
+ *   EPAPER_TRACE_END
+ */
+void EPAPER_Trace_Dump(EPAPER_Trace_Writer write)
+{
+	uint16_t count = EPAPER_Trace_Count;
+	uint16_t index = (EPAPER_Trace_Head + EPAPER_TRACE_RECORDS - count) % EPAPER_TRACE_RECORDS;
+	char line[40];
+	int len;
+
+	len = snprintf(line, sizeof(line), "EPAPER_TRACE %u %lu\r\n", count, (unsigned long)EPAPER_Trace_Dropped);
+	write(line, len);
+	for (uint16_t n = 0; n < count; n++)
+	{
+		const EPAPER_Trace_Record *r = &EPAPER_Trace_Buffer[index];
+		len = snprintf(line, sizeof(line), "%c %02X %04X %lu\r\n", r->type, r->cmd, r->arg, (unsigned long)r->value);
+		write(line, len);
+		index = (index + 1) % EPAPER_TRACE_RECORDS;
+	}
+	write("EPAPER_TRACE_END\r\n", 18);
+}
+
+/**
+ * @brief Forget every record, e.g. after a dump
+ */
+void EPAPER_Trace_Reset(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	EPAPER_Trace_Head = 0;
+	EPAPER_Trace_Count = 0;
+	EPAPER_Trace_Dropped = 0;
+	EPAPER_Trace_Last = NULL;
+	__set_PRIMASK(primask);
+}
+
+#endif
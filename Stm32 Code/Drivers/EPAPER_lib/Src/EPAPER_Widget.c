@@ -0,0 +1,149 @@
+/*
+ * EPAPER_Widget.c
+ *
+ *  Widget registry and the widgets of the clock screen
+ */
+
+#include "EPAPER_Widget.h"
+#include <string.h>
+
+static EPAPER_Widget *EPAPER_Widget_Table[EPAPER_WIDGET_MAX];
+static uint8_t EPAPER_Widget_Count = 0;
+
+static void EPAPER_Widget_Render_Hour(const EPAPER_Widget *widget)
+{
+	/* a previous minute differing in every digit redraws them all */
+	uint16_t prev = (widget->state & EPAPER_WIDGET_REDRAW) ? widget->value[0] + 1111 : widget->shown[0];
+
+	EPAPER_Print_Hour(widget->value[0], prev);
+}
+
+static void EPAPER_Widget_Render_Date(const EPAPER_Widget *widget)
+{
+	EPAPER_Print_Date(widget->value[0], widget->value[1], widget->value[2]);
+}
+
+static void EPAPER_Widget_Render_Sky(const EPAPER_Widget *widget)
+{
+	EPAPER_Print_Moon_Phase(widget->value[0], widget->value[1], 360, 1080);
+}
+
+static void EPAPER_Widget_Render_Temp(const EPAPER_Widget *widget)
+{
+	EPAPER_Print_temp(widget->value[0]);
+}
+
+static void EPAPER_Widget_Render_Press(const EPAPER_Widget *widget)
+{
+	EPAPER_Print_press(widget->value[0]);
+}
+
+static void EPAPER_Widget_Render_Hum(const EPAPER_Widget *widget)
+{
+	EPAPER_Print_hum(widget->value[0]);
+}
+
+/* screen areas of the EPAPER_Print_* layouts, the sun and moon move everywhere */
+EPAPER_Widget EPAPER_widget_hour = {.x = 60, .y = 72, .width = 88, .height = 128, .render = EPAPER_Widget_Render_Hour};
+EPAPER_Widget EPAPER_widget_date = {.x = 0, .y = 8, .width = 360, .height = 24, .render = EPAPER_Widget_Render_Date};
+EPAPER_Widget EPAPER_widget_sky = {.x = 0, .y = 0, .width = EPAPER_SCREEN_WIDTH, .height = EPAPER_SCREEN_HEIGHT, .render = EPAPER_Widget_Render_Sky};
+EPAPER_Widget EPAPER_widget_temp = {.x = 218, .y = 58, .width = 142, .height = 32, .render = EPAPER_Widget_Render_Temp};
+EPAPER_Widget EPAPER_widget_press = {.x = 215, .y = 206, .width = 145, .height = 24, .render = EPAPER_Widget_Render_Press};
+EPAPER_Widget EPAPER_widget_hum = {.x = 266, .y = 128, .width = 94, .height = 32, .render = EPAPER_Widget_Render_Hum};
+
+/**
+ * @brief Add a widget to the screen, it is drawn by the next update
+ * @param widget Must stay valid, its values can be set before or after
+ * @retval 0, -1 if the table is full
+ */
+int EPAPER_Widget_Register(EPAPER_Widget *widget)
+{
+	for (uint8_t i = 0; i < EPAPER_Widget_Count; i++)
+	{
+		if (EPAPER_Widget_Table[i] == widget)
+			return 0;
+	}
+	if (EPAPER_Widget_Count == EPAPER_WIDGET_MAX)
+		return -1;
+
+	widget->state = EPAPER_WIDGET_CHANGED | EPAPER_WIDGET_REDRAW;
+	EPAPER_Widget_Table[EPAPER_Widget_Count++] = widget;
+	return 0;
+}
+
+/**
+ * @brief Set one value of a widget
+ * @param widget Widget
+ * @param index 0 to EPAPER_WIDGET_VALUES - 1
+ * @param value New value
+ * @retval 1 if the value changed (the widget is redrawn by the next update),
+ *         0 if not, -1 for a bad index
+ */
+int EPAPER_Widget_Set(EPAPER_Widget *widget, uint8_t index, int16_t value)
+{
+	if (index >= EPAPER_WIDGET_VALUES)
+		return -1;
+	if (widget->value[index] == value)
+		return 0;
+
+	widget->value[index] = value;
+	if (memcmp(widget->value, widget->shown, sizeof(widget->value)) != 0)
+		widget->state |= EPAPER_WIDGET_CHANGED;
+	else if (!(widget->state & EPAPER_WIDGET_REDRAW))
+		widget->state &= ~EPAPER_WIDGET_CHANGED;
+	return 1;
+}
+
+/**
+ * @brief The frame buffer was wiped, every widget draws itself again
+ */
+void EPAPER_Widget_Invalidate(void)
+{
+	for (uint8_t i = 0; i < EPAPER_Widget_Count; i++)
+		EPAPER_Widget_Table[i]->state = EPAPER_WIDGET_CHANGED | EPAPER_WIDGET_REDRAW;
+}
+
+/**
+ * @brief Something else was drawn over part of the screen, redraw the
+ *        widgets it overlaps
+ * @param x, y, width, height Screen area
+ */
+void EPAPER_Widget_Invalidate_Area(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+	for (uint8_t i = 0; i < EPAPER_Widget_Count; i++)
+	{
+		EPAPER_Widget *w = EPAPER_Widget_Table[i];
+
+		if (x < w->x + w->width && w->x < x + width && y < w->y + w->height && w->y < y + height)
+			w->state = EPAPER_WIDGET_CHANGED | EPAPER_WIDGET_REDRAW;
+	}
+}
+
+/**
+ * @brief Draw the widgets that changed in the frame buffer, without sending
+ *        anything (e.g. before EPAPER_Red_Flush, which sends the whole frame)
+ */
+void EPAPER_Widget_Draw(void)
+{
+	for (uint8_t i = 0; i < EPAPER_Widget_Count; i++)
+	{
+		EPAPER_Widget *w = EPAPER_Widget_Table[i];
+
+		if (!(w->state & EPAPER_WIDGET_CHANGED))
+			continue;
+		w->render(w);
+		memcpy(w->shown, w->value, sizeof(w->shown));
+		w->state = 0;
+	}
+}
+
+/**
+ * @brief Draw the widgets that changed and send them with one refresh
+ * @param done Called from the BUSY IRQ when the refresh is over, may be NULL
+ * @retval 1 if a refresh was started, 0 if nothing changed
+ */
+uint8_t EPAPER_Widget_Update(EPAPER_Transfer_Callback done)
+{
+	EPAPER_Widget_Draw();
+	return EPAPER_Flush_Start(done);
+}
@@ -0,0 +1,259 @@
+/*
+ * pixel_assets.c
+ *
+ *  Generated by tools/asset_compiler.py from tools/assets, do not edit.
+ */
+
+#include "pixel_assets.h"
+
+// digits_40x64.bdf 0, 64x40, 320 -> 112 bytes
+static const uint8_t digit_large_data0[] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0x2F, 0xF6, 0xFB, 0xFF, 0xAF, 0x7F, 0xFE, 0xF4, 0xFF,
+	0xF1, 0xF2, 0xFF, 0xF3, 0xF0, 0xFF, 0xF5, 0xDF, 0xFF, 0x7B, 0xBF, 0xF2, 0xBA, 0x9F, 0xF6, 0x99,
+	0x9F, 0xF8, 0x98, 0x8F, 0xFA, 0x87, 0x8F, 0xFC, 0x86, 0x8F, 0xFC, 0x86, 0x7F, 0xFE, 0x76, 0x7F,
+	0xFE, 0x75, 0x8F, 0xFE, 0x84, 0x8F, 0xFE, 0x84, 0x8F, 0xFE, 0x84, 0x8F, 0xFE, 0x85, 0x7F, 0xFE,
+	0x76, 0x7F, 0xFE, 0x76, 0x8F, 0xFC, 0x86, 0x8F, 0xFC, 0x87, 0x8F, 0xFA, 0x88, 0x9F, 0xF8, 0x99,
+	0x9F, 0xF6, 0x9A, 0xBF, 0xF2, 0xBB, 0xFF, 0xF7, 0xDF, 0xFF, 0x5F, 0x0F, 0xFF, 0x3F, 0x2F, 0xFF,
+	0x1F, 0x4F, 0xFE, 0xF7, 0xFF, 0xAF, 0xBF, 0xF6, 0xFF, 0x2F, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0,
+};
+
+// digits_40x64.bdf 1, 64x40, 320 -> 104 bytes
+static const uint8_t digit_large_data1[] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xF1, 0x2F, 0x42, 0xFF, 0x96, 0xF0, 0x6F, 0xF7, 0x6F, 0x06, 0xFF, 0x68, 0xD8, 0xFF, 0x59, 0xC8,
+	0xFF, 0x69, 0xB8, 0xFF, 0x6A, 0xA8, 0xFF, 0x7A, 0x98, 0xFF, 0x8A, 0x88, 0xFF, 0x9A, 0x7F, 0xFF,
+	0xD6, 0xFF, 0xFE, 0x5F, 0xFF, 0xE5, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x04, 0xFF, 0xFE, 0x5F, 0xFF,
+	0xE5, 0xFF, 0xFC, 0x78, 0xFF, 0xFB, 0x8F, 0xFF, 0xB8, 0xFF, 0xFB, 0x8F, 0xFF, 0xB8, 0xFF, 0xFB,
+	0x8F, 0xFF, 0xC6, 0xFF, 0xFD, 0x6F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60,
+};
+
+// digits_40x64.bdf 2, 64x40, 320 -> 129 bytes
+static const uint8_t digit_large_data2[] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x06, 0xFF, 0x63, 0xF4, 0x7F, 0xF3, 0x9E, 0x9F, 0xF2,
+	0xBC, 0xBF, 0xEE, 0xAC, 0xFD, 0xF0, 0x9D, 0xFD, 0xF0, 0x8F, 0x0F, 0xBF, 0x17, 0xF1, 0xFC, 0xF0,
+	0x6F, 0x2F, 0xF1, 0xA6, 0xF4, 0xFF, 0x19, 0x5F, 0x5F, 0xF1, 0x85, 0x81, 0xCF, 0xF1, 0x84, 0x83,
+	0xCF, 0xE8, 0x48, 0x4C, 0xFE, 0x74, 0x85, 0xCF, 0xD7, 0x48, 0x7C, 0xFB, 0x83, 0x88, 0xCF, 0xA8,
+	0x38, 0x9C, 0xF9, 0x83, 0x8B, 0xBF, 0x88, 0x38, 0xCC, 0xF6, 0x74, 0x8D, 0xCF, 0x57, 0x48, 0xF0,
+	0xBF, 0x38, 0x48, 0xF1, 0xCF, 0x18, 0x48, 0xF2, 0xCE, 0x85, 0x8F, 0x3C, 0xC9, 0x58, 0xF5, 0xC8,
+	0xA6, 0x8F, 0x6F, 0xE6, 0x8F, 0x7F, 0xC7, 0x8F, 0x9F, 0x98, 0x8F, 0xAF, 0x79, 0x8F, 0xBF, 0x5A,
+	0x8F, 0xDF, 0x1D, 0x6F, 0xF1, 0xCF, 0x06, 0xFF, 0x54, 0xF6, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xF5,
+};
+
+// digits_40x64.bdf 3, 64x40, 320 -> 129 bytes
+static const uint8_t digit_large_data3[] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x93, 0xFF, 0xFE, 0x7F,
+	0x35, 0xFF, 0x48, 0xF1, 0x6F, 0xF4, 0xAD, 0x8F, 0xF3, 0xBB, 0x9F, 0x42, 0xCB, 0xB8, 0xF3, 0x6B,
+	0xB9, 0x9F, 0x36, 0xDA, 0x88, 0xF3, 0x8D, 0x97, 0x8F, 0x48, 0xE9, 0x68, 0xF4, 0x8F, 0x08, 0x67,
+	0xF5, 0x8F, 0x17, 0x67, 0xF5, 0x8F, 0x17, 0x58, 0xF5, 0x8F, 0x18, 0x48, 0xF5, 0x8F, 0x18, 0x48,
+	0xF5, 0x8F, 0x18, 0x48, 0xF5, 0x8F, 0x18, 0x57, 0xF5, 0x8F, 0x17, 0x67, 0xF5, 0x8F, 0x17, 0x68,
+	0xF3, 0xAE, 0x86, 0x8F, 0x3B, 0xC9, 0x78, 0xF1, 0xDA, 0x98, 0x9E, 0xF0, 0x8A, 0x99, 0xCF, 0xF3,
+	0xAB, 0x8F, 0xF4, 0xCF, 0xFF, 0x7D, 0xFB, 0x2F, 0x7F, 0x0F, 0x95, 0xF3, 0xF3, 0xF7, 0x7F, 0x1F,
+	0x5F, 0x5A, 0xCF, 0x9F, 0x1F, 0x14, 0xFF, 0x0C, 0xFF, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x50,
+};
+
+// digits_40x64.bdf 4, 64x40, 320 -> 108 bytes
+static const uint8_t digit_large_data4[] =
+{
+	0xFF, 0xFF, 0xFA, 0x2F, 0xFF, 0xF0, 0x6F, 0xFF, 0xD7, 0xFF, 0xFB, 0xAF, 0xFF, 0x9C, 0xFF, 0xF7,
+	0xDF, 0xFF, 0x6F, 0x0F, 0xFF, 0x4F, 0x2F, 0xFF, 0x2F, 0x3F, 0xFF, 0x1F, 0x5F, 0xFE, 0xF7, 0xFF,
+	0xC8, 0x1E, 0xFF, 0xB8, 0x3E, 0xFF, 0x98, 0x5D, 0xFF, 0x88, 0x6E, 0xFF, 0x68, 0x8E, 0xFF, 0x48,
+	0xAD, 0xFF, 0x38, 0xBE, 0xFF, 0x18, 0xDE, 0xFE, 0x8E, 0xEF, 0xD8, 0xF1, 0xEF, 0xB8, 0xF3, 0xEB,
+	0xFF, 0xF9, 0x8F, 0xFF, 0xD6, 0xFF, 0xFD, 0x5F, 0xFF, 0xF0, 0x4F, 0xFF, 0xF0, 0x5F, 0xFF, 0xD6,
+	0xFF, 0xFD, 0x8F, 0xFF, 0x9F, 0x88, 0xFF, 0xFB, 0x8F, 0xFF, 0xB8, 0xFF, 0xFB, 0x8F, 0xFF, 0xB8,
+	0xFF, 0xFB, 0x8F, 0xFF, 0xC6, 0xFF, 0xFD, 0x6F, 0xFF, 0xF0, 0x2F, 0xFB,
+};
+
+// digits_40x64.bdf 5, 64x40, 320 -> 128 bytes
+static const uint8_t digit_large_data5[] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x4F, 0xF7, 0x5F, 0x1F,
+	0xED, 0x6F, 0x1F, 0xF1, 0xA8, 0xEF, 0xF2, 0xA8, 0xEF, 0xF3, 0x89, 0xEF, 0xF3, 0x79, 0xF1, 0xFF,
+	0x27, 0x8F, 0x3F, 0xF1, 0x78, 0xF3, 0x8F, 0x08, 0x68, 0xF5, 0x8E, 0x86, 0x8F, 0x58, 0xE8, 0x67,
+	0xF7, 0x7E, 0x86, 0x7F, 0x77, 0xE8, 0x58, 0xF7, 0x8D, 0x85, 0x8F, 0x78, 0xD8, 0x58, 0xF7, 0x8D,
+	0x85, 0x8F, 0x78, 0xD8, 0x67, 0xF7, 0x7E, 0x86, 0x7F, 0x77, 0xE8, 0x68, 0xF5, 0x8E, 0x86, 0x8F,
+	0x58, 0xE8, 0x78, 0xF3, 0x8F, 0x08, 0x78, 0xF3, 0x8F, 0x08, 0x79, 0xF1, 0x9F, 0x08, 0x8A, 0xCA,
+	0xF1, 0x89, 0xB8, 0xBF, 0x28, 0x9F, 0xF0, 0xF2, 0x8A, 0xFD, 0xF3, 0x8B, 0xFB, 0xF4, 0x8C, 0xF9,
+	0xF6, 0x6F, 0x0F, 0x5F, 0x86, 0xF1, 0xF3, 0xFB, 0x2F, 0x6C, 0xFF, 0xFB, 0x4F, 0xFF, 0xFF, 0xFE,
+};
+
+// digits_40x64.bdf 6, 64x40, 320 -> 120 bytes
+static const uint8_t digit_large_data6[] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x4F, 0xFF, 0xBC, 0xFF, 0xF5, 0xF1, 0xFF, 0xF1, 0xF5, 0xFF, 0xDF,
+	0x7F, 0xFB, 0xFA, 0xFF, 0x8F, 0xCF, 0xF6, 0xFE, 0xFF, 0x4B, 0x8D, 0xFF, 0x29, 0xCC, 0xFF, 0x09,
+	0xED, 0xFD, 0x8F, 0x1D, 0xFB, 0x8F, 0x3E, 0xF9, 0x8F, 0x3F, 0x0F, 0x87, 0xF5, 0xF0, 0xF7, 0x7F,
+	0x5F, 0x2F, 0x48, 0xF5, 0xF3, 0xF3, 0x8F, 0x5F, 0x5F, 0x18, 0xF5, 0x81, 0xCF, 0x08, 0xF5, 0x82,
+	0xDE, 0x7F, 0x57, 0x4D, 0xD7, 0xF5, 0x76, 0xCC, 0x8F, 0x38, 0x7D, 0xA8, 0xF3, 0x89, 0xCA, 0x8F,
+	0x18, 0xBD, 0x89, 0xE9, 0xDB, 0x99, 0xC9, 0xF0, 0xB8, 0xB8, 0xBF, 0x1A, 0x9F, 0xDF, 0x47, 0xBF,
+	0xBF, 0x66, 0xCF, 0x9F, 0x92, 0xF0, 0xF7, 0xFF, 0xDF, 0x5F, 0xFF, 0x1F, 0x1F, 0xFF, 0x5C, 0xFF,
+	0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+};
+
+// digits_40x64.bdf 7, 64x40, 320 -> 114 bytes
+static const uint8_t digit_large_data7[] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0xFF, 0xFF, 0x06, 0xFF, 0xFD, 0x6F, 0xFF, 0xC8, 0xFF,
+	0xFB, 0x8F, 0xFF, 0xB8, 0xFF, 0xFB, 0x8F, 0xFF, 0xB8, 0xFF, 0xFB, 0x87, 0x2F, 0xFF, 0x28, 0x57,
+	0xFF, 0xE8, 0x59, 0xFF, 0xC8, 0x4D, 0xFF, 0x98, 0x4F, 0x1F, 0xF6, 0x85, 0xF3, 0xFF, 0x38, 0x5F,
+	0x5F, 0xF1, 0x87, 0xF6, 0xFD, 0x8A, 0xF6, 0xFA, 0x8D, 0xF6, 0xF7, 0x8F, 0x0F, 0x6F, 0x58, 0xF3,
+	0xF6, 0xF2, 0x8F, 0x6F, 0x6E, 0x8F, 0x9F, 0x5C, 0x8F, 0xBF, 0x69, 0x8F, 0xEF, 0x66, 0x8F, 0xF2,
+	0xF6, 0x38, 0xFF, 0x4F, 0x61, 0x8F, 0xF7, 0xFC, 0xFF, 0xAF, 0x9F, 0xFD, 0xF6, 0xFF, 0xF0, 0xF4,
+	0xFF, 0xF3, 0xF1, 0xFF, 0xF6, 0xDF, 0xFF, 0x99, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF,
+	0xFF, 0xFD,
+};
+
+// digits_40x64.bdf 8, 64x40, 320 -> 130 bytes
+static const uint8_t digit_large_data8[] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x4F, 0xFF, 0xBC, 0xFF, 0xF5, 0xF1, 0xF2, 0x4F, 0xAF, 0x5B, 0xCF,
+	0x5F, 0x78, 0xF1, 0xF2, 0xF9, 0x6F, 0x3F, 0x0F, 0xB3, 0xF7, 0xCF, 0xD1, 0xF9, 0xAB, 0x8F, 0xF5,
+	0xA9, 0xCF, 0xF4, 0x89, 0xEF, 0x18, 0xA7, 0x8F, 0x1E, 0xA9, 0x68, 0xF3, 0xCC, 0x95, 0x8F, 0x3B,
+	0xE8, 0x57, 0xF5, 0x9F, 0x17, 0x57, 0xF5, 0x9F, 0x17, 0x48, 0xF5, 0x9F, 0x18, 0x38, 0xF5, 0x9F,
+	0x18, 0x38, 0xF5, 0x9F, 0x18, 0x38, 0xF5, 0x9F, 0x18, 0x47, 0xF5, 0x9F, 0x17, 0x57, 0xF5, 0x9F,
+	0x17, 0x58, 0xF3, 0xBE, 0x85, 0x8F, 0x3C, 0xC9, 0x68, 0xF1, 0xEA, 0x97, 0x9E, 0xF1, 0x8A, 0x89,
+	0xCF, 0xF4, 0x9B, 0x8F, 0xF5, 0xBF, 0xD1, 0xF9, 0xCF, 0xB3, 0xF7, 0xEF, 0x96, 0xF3, 0xF2, 0xF7,
+	0x8F, 0x1F, 0x4F, 0x5B, 0xCF, 0x8F, 0x1F, 0x24, 0xFE, 0xCF, 0xFF, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xF6,
+};
+
+// digits_40x64.bdf 9, 64x40, 320 -> 120 bytes
+static const uint8_t digit_large_data9[] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x4F, 0xFF, 0xBC, 0xFF, 0xF5, 0xF1, 0xFF, 0xF1, 0xF5, 0xFF,
+	0xDF, 0x7F, 0x02, 0xF9, 0xF9, 0xC6, 0xF6, 0xFB, 0xB7, 0xF4, 0xFD, 0x9A, 0xF1, 0xB8, 0xB8, 0xBF,
+	0x09, 0xC9, 0x9B, 0xD9, 0xE9, 0x8D, 0xB8, 0xF1, 0x8A, 0xC9, 0x8F, 0x38, 0xAD, 0x78, 0xF3, 0x8C,
+	0xC6, 0x7F, 0x57, 0xDD, 0x47, 0xF5, 0x7E, 0xD2, 0x8F, 0x58, 0xF0, 0xC1, 0x8F, 0x58, 0xF1, 0xF5,
+	0xF5, 0x8F, 0x3F, 0x3F, 0x58, 0xF4, 0xF2, 0xF5, 0x7F, 0x7F, 0x0F, 0x57, 0xF8, 0xF0, 0xF3, 0x8F,
+	0x9E, 0xF3, 0x8F, 0xBD, 0xF1, 0x8F, 0xDD, 0xE9, 0xFF, 0x0C, 0xC9, 0xFF, 0x2D, 0x8B, 0xFF, 0x4F,
+	0xEF, 0xF6, 0xFC, 0xFF, 0x8F, 0xAF, 0xFB, 0xF7, 0xFF, 0xDF, 0x5F, 0xFF, 0x1F, 0x1F, 0xFF, 0x5C,
+	0xFF, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+};
+
+static const EPAPER_Bitmap digit_large_glyph[10] =
+{
+	{64, 40, digit_large_data0}, // 0
+	{64, 40, digit_large_data1}, // 1
+	{64, 40, digit_large_data2}, // 2
+	{64, 40, digit_large_data3}, // 3
+	{64, 40, digit_large_data4}, // 4
+	{64, 40, digit_large_data5}, // 5
+	{64, 40, digit_large_data6}, // 6
+	{64, 40, digit_large_data7}, // 7
+	{64, 40, digit_large_data8}, // 8
+	{64, 40, digit_large_data9}, // 9
+};
+
+const EPAPER_Font digit_large = {'0', 10, digit_large_glyph};
+
+// sun.png 0, 32x32, 128 -> 63 bytes
+static const uint8_t sun_icon_data0[] =
+{
+	0xFF, 0xFF, 0xF4, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0x61, 0x82, 0x81, 0xB3, 0x72, 0x73, 0xB3, 0xE3,
+	0xD3, 0xC3, 0xF0, 0x2C, 0x2F, 0x66, 0xF9, 0xAF, 0x7A, 0xF6, 0xCF, 0x5C, 0xC5, 0x3C, 0x35, 0x45,
+	0x3C, 0x35, 0xCC, 0xF5, 0xCF, 0x6A, 0xF7, 0xAF, 0x96, 0xF6, 0x2C, 0x2F, 0x03, 0xC3, 0xD3, 0xE3,
+	0xB3, 0x72, 0x73, 0xB1, 0x82, 0x81, 0xF6, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xFF, 0xFF, 0x40,
+};
+
+const EPAPER_Bitmap sun_icon = {32, 32, sun_icon_data0};
+
+// moon.png 0, 32x32, 128 -> 48 bytes
+static const uint8_t moon_icon_data0[] =
+{
+	0xFF, 0xFF, 0xF0, 0xAF, 0x5E, 0xF1, 0xF3, 0xDF, 0x5B, 0xF7, 0x9F, 0x98, 0xF9, 0x7F, 0xB6, 0xFB,
+	0x5F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x5F,
+	0xB6, 0xFB, 0x7F, 0x98, 0xF9, 0x9F, 0x7B, 0xF5, 0xDF, 0x3F, 0x1E, 0xF5, 0xAF, 0xFF, 0xFF, 0x00,
+};
+
+// moon.png 1, 32x32, 128 -> 55 bytes
+static const uint8_t moon_icon_data1[] =
+{
+	0xFF, 0xFF, 0xF0, 0xAF, 0x54, 0x64, 0xF1, 0x3C, 0x3D, 0x3E, 0x3B, 0x25, 0x85, 0x29, 0x23, 0xE3,
+	0x28, 0x21, 0xF3, 0x12, 0x7F, 0xB6, 0xFB, 0x5F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD,
+	0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x5F, 0xB6, 0xFB, 0x7F, 0x98, 0xF9, 0x9F, 0x7B, 0xF5, 0xDF,
+	0x3F, 0x1E, 0xF5, 0xAF, 0xFF, 0xFF, 0x00,
+};
+
+// moon.png 2, 32x32, 128 -> 60 bytes
+static const uint8_t moon_icon_data2[] =
+{
+	0xFF, 0xFF, 0xF0, 0xAF, 0x54, 0x64, 0xF1, 0x3C, 0x3D, 0x3E, 0x3B, 0x2F, 0x32, 0x92, 0xF5, 0x28,
+	0x2F, 0x52, 0x72, 0xF7, 0x26, 0x1F, 0x91, 0x52, 0xF9, 0x24, 0x2F, 0x92, 0x41, 0xFB, 0x14, 0x1F,
+	0xB1, 0x41, 0xFB, 0x14, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x5F, 0xB6, 0xFB, 0x7F, 0x98,
+	0xF9, 0x9F, 0x7B, 0xF5, 0xDF, 0x3F, 0x1E, 0xF5, 0xAF, 0xFF, 0xFF, 0x00,
+};
+
+// moon.png 3, 32x32, 128 -> 69 bytes
+static const uint8_t moon_icon_data3[] =
+{
+	0xFF, 0xFF, 0xF0, 0xAF, 0x54, 0x64, 0xF1, 0x3C, 0x3D, 0x3E, 0x3B, 0x2F, 0x32, 0x92, 0xF5, 0x28,
+	0x2F, 0x52, 0x72, 0xF7, 0x26, 0x1F, 0x91, 0x52, 0xF9, 0x24, 0x2F, 0x92, 0x41, 0xFB, 0x14, 0x1F,
+	0xB1, 0x41, 0xFB, 0x14, 0x1F, 0xB1, 0x41, 0xFB, 0x14, 0x1F, 0xB1, 0x42, 0xF9, 0x24, 0x2F, 0x92,
+	0x51, 0xF9, 0x16, 0x2F, 0x72, 0x73, 0xF3, 0x38, 0x5E, 0x59, 0x78, 0x7B, 0xF5, 0xDF, 0x3F, 0x1E,
+	0xF5, 0xAF, 0xFF, 0xFF, 0x00,
+};
+
+// moon.png 4, 32x32, 128 -> 72 bytes
+static const uint8_t moon_icon_data4[] =
+{
+	0xFF, 0xFF, 0xF0, 0xAF, 0x54, 0x64, 0xF1, 0x3C, 0x3D, 0x3E, 0x3B, 0x2F, 0x32, 0x92, 0xF5, 0x28,
+	0x2F, 0x52, 0x72, 0xF7, 0x26, 0x1F, 0x91, 0x52, 0xF9, 0x24, 0x2F, 0x92, 0x41, 0xFB, 0x14, 0x1F,
+	0xB1, 0x41, 0xFB, 0x14, 0x1F, 0xB1, 0x41, 0xFB, 0x14, 0x1F, 0xB1, 0x42, 0xF9, 0x24, 0x2F, 0x92,
+	0x51, 0xF9, 0x16, 0x2F, 0x72, 0x72, 0xF5, 0x28, 0x2F, 0x52, 0x92, 0xF3, 0x2B, 0x3E, 0x3D, 0x3C,
+	0x3F, 0x14, 0x64, 0xF5, 0xAF, 0xFF, 0xFF, 0x00,
+};
+
+// moon.png 5, 32x32, 128 -> 69 bytes
+static const uint8_t moon_icon_data5[] =
+{
+	0xFF, 0xFF, 0xF0, 0xAF, 0x5E, 0xF1, 0xF3, 0xDF, 0x5B, 0x78, 0x79, 0x5E, 0x58, 0x3F, 0x33, 0x72,
+	0xF7, 0x26, 0x1F, 0x91, 0x52, 0xF9, 0x24, 0x2F, 0x92, 0x41, 0xFB, 0x14, 0x1F, 0xB1, 0x41, 0xFB,
+	0x14, 0x1F, 0xB1, 0x41, 0xFB, 0x14, 0x1F, 0xB1, 0x42, 0xF9, 0x24, 0x2F, 0x92, 0x51, 0xF9, 0x16,
+	0x2F, 0x72, 0x72, 0xF5, 0x28, 0x2F, 0x52, 0x92, 0xF3, 0x2B, 0x3E, 0x3D, 0x3C, 0x3F, 0x14, 0x64,
+	0xF5, 0xAF, 0xFF, 0xFF, 0x00,
+};
+
+// moon.png 6, 32x32, 128 -> 60 bytes
+static const uint8_t moon_icon_data6[] =
+{
+	0xFF, 0xFF, 0xF0, 0xAF, 0x5E, 0xF1, 0xF3, 0xDF, 0x5B, 0xF7, 0x9F, 0x98, 0xF9, 0x7F, 0xB6, 0xFB,
+	0x5F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0x1F, 0xB1, 0x41, 0xFB, 0x14, 0x1F, 0xB1, 0x42,
+	0xF9, 0x24, 0x2F, 0x92, 0x51, 0xF9, 0x16, 0x2F, 0x72, 0x72, 0xF5, 0x28, 0x2F, 0x52, 0x92, 0xF3,
+	0x2B, 0x3E, 0x3D, 0x3C, 0x3F, 0x14, 0x64, 0xF5, 0xAF, 0xFF, 0xFF, 0x00,
+};
+
+// moon.png 7, 32x32, 128 -> 55 bytes
+static const uint8_t moon_icon_data7[] =
+{
+	0xFF, 0xFF, 0xF0, 0xAF, 0x5E, 0xF1, 0xF3, 0xDF, 0x5B, 0xF7, 0x9F, 0x98, 0xF9, 0x7F, 0xB6, 0xFB,
+	0x5F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x5F,
+	0xB6, 0xFB, 0x72, 0x1F, 0x31, 0x28, 0x23, 0xE3, 0x29, 0x25, 0x85, 0x2B, 0x3E, 0x3D, 0x3C, 0x3F,
+	0x14, 0x64, 0xF5, 0xAF, 0xFF, 0xFF, 0x00,
+};
+
+// moon.png 8, 32x32, 128 -> 48 bytes
+static const uint8_t moon_icon_data8[] =
+{
+	0xFF, 0xFF, 0xF0, 0xAF, 0x5E, 0xF1, 0xF3, 0xDF, 0x5B, 0xF7, 0x9F, 0x98, 0xF9, 0x7F, 0xB6, 0xFB,
+	0x5F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x5F,
+	0xB6, 0xFB, 0x7F, 0x98, 0xF9, 0x9F, 0x7B, 0xF5, 0xDF, 0x3F, 0x1E, 0xF5, 0xAF, 0xFF, 0xFF, 0x00,
+};
+
+const EPAPER_Bitmap moon_icon[9] =
+{
+	{32, 32, moon_icon_data0},
+	{32, 32, moon_icon_data1},
+	{32, 32, moon_icon_data2},
+	{32, 32, moon_icon_data3},
+	{32, 32, moon_icon_data4},
+	{32, 32, moon_icon_data5},
+	{32, 32, moon_icon_data6},
+	{32, 32, moon_icon_data7},
+	{32, 32, moon_icon_data8},
+};
@@ -473,118 +473,3 @@ const uint8_t bpixel [] =
 	0b11111111,
 };
 
-
-const uint8_t icone [] =
-{
-	//soleil
-	0b11111111, 0b11111111,
-	0b11111111, 0b01111111,
-	0b11101111, 0b01111011,
-	0b11110111, 0b11110111,
-	0b11111110, 0b00111111,
-	0b11111101, 0b11011111,
-	0b11111011, 0b11101111,
-	0b11001011, 0b11101001,
-	0b11111011, 0b11101111,
-	0b11111101, 0b11011111,
-	0b11111110, 0b00111111,
-	0b11110111, 0b11110111,
-	0b11101111, 0b01111011,
-	0b11111111, 0b01111111,
-	0b11111111, 0b11111111,
-	0b11111111, 0b11111111,
-};
-
-const uint8_t moon [] =
-{
-	//new moon
-	0b11111111, 0b11111111,
-	0b11111100, 0b00111111,
-	0b11110000, 0b00001111,
-	0b11100000, 0b00000111,
-	0b11000000, 0b00000011,
-	0b11000000, 0b00000011,
-	0b10000000, 0b00000001,
-	0b10000000, 0b00000001,
-	0b10000000, 0b00000001,
-	0b10000000, 0b00000001,
-	0b11000000, 0b00000011,
-	0b11000000, 0b00000011,
-	0b11100000, 0b00000111,
-	0b11110000, 0b00001111,
-	0b11111100, 0b00111111,
-	0b11111111, 0b11111111,
-
-	//crescent moon
-	0b11111111, 0b11111111,
-	0b11111100, 0b00111111,
-	0b11110011, 0b11001111,
-	0b11101111, 0b11110111,
-	0b11011111, 0b11111011,
-	0b11011000, 0b00011011,
-	0b10100000, 0b00000101,
-	0b10000000, 0b00000001,
-	0b10000000, 0b00000001,
-	0b10000000, 0b00000001,
-	0b11000000, 0b00000011,
-	0b11000000, 0b00000011,
-	0b11100000, 0b00000111,
-	0b11110000, 0b00001111,
-	0b11111100, 0b00111111,
-	0b11111111, 0b11111111,
-
-	//half moon
-	0b11111111, 0b11111111,
-	0b11111100, 0b00111111,
-	0b11110011, 0b11001111,
-	0b11101111, 0b11110111,
-	0b11011111, 0b11111011,
-	0b11011111, 0b11111011,
-	0b10111111, 0b11111101,
-	0b10111111, 0b11111101,
-	0b10000000, 0b00000001,
-	0b10000000, 0b00000001,
-	0b11000000, 0b00000011,
-	0b11000000, 0b00000011,
-	0b11100000, 0b00000111,
-	0b11110000, 0b00001111,
-	0b11111100, 0b00111111,
-	0b11111111, 0b11111111,
-
-	//gibbous moon
-	0b11111111, 0b11111111,
-	0b11111100, 0b00111111,
-	0b11110011, 0b11001111,
-	0b11101111, 0b11110111,
-	0b11011111, 0b11111011,
-	0b11011111, 0b11111011,
-	0b10111111, 0b11111101,
-	0b10111111, 0b11111101,
-	0b10011111, 0b11111001,
-	0b10001111, 0b11110001,
-	0b11000011, 0b11000011,
-	0b11000000, 0b00000011,
-	0b11100000, 0b00000111,
-	0b11110000, 0b00001111,
-	0b11111100, 0b00111111,
-	0b11111111, 0b11111111,
-
-	//full moon
-	0b11111111, 0b11111111,
-	0b11111100, 0b00111111,
-	0b11110011, 0b11001111,
-	0b11101111, 0b11110111,
-	0b11011111, 0b11111011,
-	0b11011111, 0b11111011,
-	0b10111111, 0b11111101,
-	0b10111111, 0b11111101,
-	0b10111111, 0b11111101,
-	0b10111111, 0b11111101,
-	0b11011111, 0b11111011,
-	0b11011111, 0b11111011,
-	0b11101111, 0b11110111,
-	0b11110011, 0b11001111,
-	0b11111100, 0b00111111,
-	0b11111111, 0b11111111,
-
-};
@@ -18,6 +18,8 @@
 
 #define ESP01_TIMEOUT 2000
 
+#define ESP01_RESP_SIZE 512 // AT response and command buffers, taken from the scratch arena
+
 extern uint8_t dma_rx_buf[1024]; // Buffer DMA pour la réception ESP01
 extern UART_HandleTypeDef *wifi_uart;
 
@@ -31,7 +33,7 @@ int Send_ATCMD_DMA(const char *cmd, char *response_buffer, size_t response_buf_s
 int Read_DMA_Until_Pattern(const char *pattern, char *resp_buf, size_t bufsize, uint32_t timeout_ms);
 void Flush_Rx_Buffer(uint32_t timeout_ms);
 int Init_Wifi(const char *ssid, const char *passwd);
-int Get_Date(uint8_t *day, uint8_t *dd, uint8_t *mm, uint16_t *yy, uint16_t *minute);
+int Get_Date(uint8_t *day, uint8_t *dd, uint8_t *mm, uint16_t *yy, uint16_t *minute, uint8_t *second);
 uint8_t day_from_str(const char *day);
 uint8_t month_from_str(const char *month);
 int Date_from_HTTP(const char *trame, char *date_buf, size_t date_buf_size);
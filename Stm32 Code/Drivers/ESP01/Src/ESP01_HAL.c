@@ -15,6 +15,10 @@
  */
 
 #include "ESP01_HAL.h"
+#include "energy.h"
+#include "port.h"
+#include "probe.h"
+#include "scratch.h"
 #include "stdio.h"
 #include "string.h"
 
@@ -76,6 +80,10 @@ volatile uint16_t rx_last_pos = 0;     // Last read position in DMA buffer
  */
 int Send_ATCMD_DMA(const char *cmd, char *response_buffer, size_t response_buf_size, const char *expected, uint32_t timeout_ms)
 {
+	int ret = 0;
+
+	PROBE_BEGIN(PROBE_AT_COMMAND);
+
 	/* Clear pending RX data before sending a new command */
 	Flush_Rx_Buffer(10);
 
@@ -85,8 +93,8 @@ int Send_ATCMD_DMA(const char *cmd, char *response_buffer, size_t response_buf_s
 #endif //ESP01_DEBUG
 
 	/* Send command and CRLF */
-	HAL_UART_Transmit(wifi_uart, (uint8_t *)cmd, strlen(cmd), HAL_MAX_DELAY);
-	HAL_UART_Transmit(wifi_uart, (uint8_t *)"\r\n", 2, HAL_MAX_DELAY);
+	Port_UART_Write(wifi_uart->Instance, (const uint8_t *)cmd, strlen(cmd));
+	Port_UART_Write(wifi_uart->Instance, (const uint8_t *)"\r\n", 2);
 
 	uint32_t start = HAL_GetTick();
 	size_t resp_len = 0;
@@ -123,10 +131,11 @@ int Send_ATCMD_DMA(const char *cmd, char *response_buffer, size_t response_buf_s
 #if ESP01_DEBUG
     	Send_To_PC("expected not found\r\n");
 #endif //ESP01_DEBUG
-    	return -1;
+    	ret = -1;
     }
 
-    return 0;
+    PROBE_END(PROBE_AT_COMMAND);
+    return ret;
 }
 
 /**
@@ -241,61 +250,83 @@ void Flush_Rx_Buffer(uint32_t timeout_ms)
 
 /**
  * @brief  Initialize the ESP01 module and connect to a WiFi network.
+ *         resp and cmd are scratch buffers of ESP01_RESP_SIZE bytes.
  * @param  ssid     WiFi SSID.
  *
  * @retval 0  Success
  * @retval -1 Failure at any step
  */
-int Init_Wifi(const char *ssid, const char *passwd)
+static int Init_Wifi_Steps(const char *ssid, const char *passwd, char *resp, char *cmd)
 {
-	char resp[512]; /* Buffer for ESP responses */
-	char cmd[512] = {0}; /* Buffer for dynamic AT commands */
-
 	/* Start UART DMA reception */
 	HAL_UART_Receive_DMA(wifi_uart, dma_rx_buf, 1024);
 	HAL_Delay(500); /* Allow ESP to stabilize */
 
 	/* Test communication */
-	if(Send_ATCMD_DMA("AT", resp, sizeof(resp), "OK", ESP01_TIMEOUT)!=0) return -1;
+	if(Send_ATCMD_DMA("AT", resp, ESP01_RESP_SIZE, "OK", ESP01_TIMEOUT)!=0) return -1;
 
 	/* Set WiFi mode to Station */
-	if(Send_ATCMD_DMA("AT+CWMODE=1", resp, sizeof(resp), "OK", ESP01_TIMEOUT)!=0) return -1;
+	if(Send_ATCMD_DMA("AT+CWMODE=1", resp, ESP01_RESP_SIZE, "OK", ESP01_TIMEOUT)!=0) return -1;
 
 	/* Enable DHCP */
-	if(Send_ATCMD_DMA("AT+CWDHCP=1,1", resp, sizeof(resp), "OK", ESP01_TIMEOUT)!=0) return -1;
+	if(Send_ATCMD_DMA("AT+CWDHCP=1,1", resp, ESP01_RESP_SIZE, "OK", ESP01_TIMEOUT)!=0) return -1;
 
 	/* Connect to WiFi network */
-	snprintf(cmd, sizeof(cmd), "AT+CWJAP=\"%s\",\"%s\"", ssid, passwd);
+	snprintf(cmd, ESP01_RESP_SIZE, "AT+CWJAP=\"%s\",\"%s\"", ssid, passwd);
 
 	/* Connection may take several seconds */
-	if(Send_ATCMD_DMA(cmd, resp, sizeof(resp), "OK", 15000)!=0) return -1;
+	if(Send_ATCMD_DMA(cmd, resp, ESP01_RESP_SIZE, "OK", 15000)!=0) return -1;
 
 	/* Request IP address */
-	if(Send_ATCMD_DMA("AT+CIFSR", resp, sizeof(resp), "OK", ESP01_TIMEOUT)!=0) return -1;
+	if(Send_ATCMD_DMA("AT+CIFSR", resp, ESP01_RESP_SIZE, "OK", ESP01_TIMEOUT)!=0) return -1;
 
 	return 0;
 }
 
+/**
+ * @brief  Initialize the ESP01 module and connect to a WiFi network.
+ * @param  ssid     WiFi SSID.
+ *
+ * @retval 0  Success
+ * @retval -1 Failure at any step, or no scratch memory
+ */
+int Init_Wifi(const char *ssid, const char *passwd)
+{
+	size_t mark = Scratch_Mark();
+	char *resp = Scratch_Alloc(ESP01_RESP_SIZE); /* Buffer for ESP responses */
+	char *cmd = Scratch_Alloc(ESP01_RESP_SIZE);  /* Buffer for dynamic AT commands */
+	int ret = -1;
+
+	ENERGY_START(ENERGY_WIFI_ACTIVE);
+	if (resp && cmd) ret = Init_Wifi_Steps(ssid, passwd, resp, cmd);
+	ENERGY_STOP(ENERGY_WIFI_ACTIVE);
+
+	Scratch_Release(mark);
+	return ret;
+}
+
 /**
  * @brief  Retrieve current date and time from google server.
  *         Date is extracted from the HTTP "Date" header.
+ *         resp is a scratch buffer of ESP01_RESP_SIZE bytes.
  * @param  day     Output day of week (0=Mon ... 6=Sun).
  * @param  dd      Output day of month.
  * @param  mm      Output month (0=Jan ... 11=Dec).
  * @param  yy      Output year.
  * @param  minute  Output time in minutes since midnight.
+ * @param  second  Output seconds of the minute.
  *
  * @retval 0  Success
  * @retval -1 Failure (communication, parsing, or timeout error)
  */
-int Get_Date(uint8_t *day, uint8_t *dd, uint8_t *mm, uint16_t *yy, uint16_t *minute)
+static int Get_Date_Steps(uint8_t *day, uint8_t *dd, uint8_t *mm, uint16_t *yy, uint16_t *minute, uint8_t *second, char *resp)
 {
-	char resp[512]; /* Buffer for ESP responses */
 	char date[40];  /* Extracted HTTP date string */
 
 	/* need int value for sscanf function on stm32*/
 	int hour;
 	int min;
+	int sec;
 	int dd_var;
 	int yy_var;
 
@@ -303,16 +334,16 @@ int Get_Date(uint8_t *day, uint8_t *dd, uint8_t *mm, uint16_t *yy, uint16_t *min
 	char month_str[4]; /* 3-letter month string (e.g. "Jan") */
 
 	/* Open TCP connection to Google server */
-	if(Send_ATCMD_DMA("AT+CIPSTART=\"TCP\",\"216.239.35.0\",80", resp, sizeof(resp), "OK", ESP01_TIMEOUT)!=0) return -1;
+	if(Send_ATCMD_DMA("AT+CIPSTART=\"TCP\",\"216.239.35.0\",80", resp, ESP01_RESP_SIZE, "OK", ESP01_TIMEOUT)!=0) return -1;
 
 	/* Inform ESP8266 of upcoming HTTP request length */
-	if(Send_ATCMD_DMA("AT+CIPSEND=38", resp, sizeof(resp), ">", ESP01_TIMEOUT)!=0) return -1;
+	if(Send_ATCMD_DMA("AT+CIPSEND=38", resp, ESP01_RESP_SIZE, ">", ESP01_TIMEOUT)!=0) return -1;
 
 	/* Send minimal HTTP GET request */
-	if(Send_ATCMD_DMA("GET / HTTP/1.1\r\nHost: 216.239.35.0\r\n", resp, sizeof(resp), "+IPD", ESP01_TIMEOUT)!=0) return -1;
+	if(Send_ATCMD_DMA("GET / HTTP/1.1\r\nHost: 216.239.35.0\r\n", resp, ESP01_RESP_SIZE, "+IPD", ESP01_TIMEOUT)!=0) return -1;
 
 	/* Read incoming data until end of Date header */
-	if(Read_DMA_Until_Pattern("GMT\r\n", resp, sizeof(resp), ESP01_TIMEOUT)!=0) return -1;
+	if(Read_DMA_Until_Pattern("GMT\r\n", resp, ESP01_RESP_SIZE, ESP01_TIMEOUT)!=0) return -1;
 
 	/*
 	 * Expected HTTP header format:
@@ -321,21 +352,48 @@ int Get_Date(uint8_t *day, uint8_t *dd, uint8_t *mm, uint16_t *yy, uint16_t *min
 	if(Date_from_HTTP(resp, date, sizeof(date))!=0) return -1;
 
 	/* Parse date components */
-	if(sscanf(date, "%3s, %2d %3s %4d %2d:%2d", day_str, &dd_var, month_str, &yy_var, &hour, &min) != 6) return -1;
+	if(sscanf(date, "%3s, %2d %3s %4d %2d:%2d:%2d", day_str, &dd_var, month_str, &yy_var, &hour, &min, &sec) != 7) return -1;
 
 	/* Convert and store results */
 	*minute = hour*60 + min;
+	*second = sec;
 	*dd = dd_var;
 	*yy = yy_var;
 	*day = day_from_str(day_str);
 	*mm = month_from_str(month_str);
 
 	/* Close TCP connection */
-	if(Send_ATCMD_DMA("AT+CIPCLOSE", resp, sizeof(resp), "OK", ESP01_TIMEOUT)!=0) return -1;
+	if(Send_ATCMD_DMA("AT+CIPCLOSE", resp, ESP01_RESP_SIZE, "OK", ESP01_TIMEOUT)!=0) return -1;
 	return 0;
 
 }
 
+/**
+ * @brief  Retrieve current date and time from google server.
+ * @param  day     Output day of week (0=Mon ... 6=Sun).
+ * @param  dd      Output day of month.
+ * @param  mm      Output month (0=Jan ... 11=Dec).
+ * @param  yy      Output year.
+ * @param  minute  Output time in minutes since midnight.
+ * @param  second  Output seconds of the minute.
+ *
+ * @retval 0  Success
+ * @retval -1 Failure (communication, parsing, timeout error or no scratch memory)
+ */
+int Get_Date(uint8_t *day, uint8_t *dd, uint8_t *mm, uint16_t *yy, uint16_t *minute, uint8_t *second)
+{
+	size_t mark = Scratch_Mark();
+	char *resp = Scratch_Alloc(ESP01_RESP_SIZE); /* Buffer for ESP responses */
+	int ret = -1;
+
+	ENERGY_START(ENERGY_WIFI_ACTIVE);
+	if (resp) ret = Get_Date_Steps(day, dd, mm, yy, minute, second, resp);
+	ENERGY_STOP(ENERGY_WIFI_ACTIVE);
+
+	Scratch_Release(mark);
+	return ret;
+}
+
 /**
  * @brief  Convert a 3-letter day string to a numeric value.
  * @param  day  Three-letter day string (e.g. "Mon").
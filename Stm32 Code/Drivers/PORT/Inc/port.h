@@ -0,0 +1,139 @@
+/*
+ * port.h
+ *
+ *  Board port of the shared drivers: the few pin, SPI and UART accesses made
+ *  byte by byte, as inline register writes for the MCU family the project is
+ *  built for. main.h of the project brings the CMSIS device header and the
+ *  pin names generated by CubeMX.
+ *
+ *  Only the per-byte paths are here. Peripheral setup, DMA, I2C and UART
+ *  reception stay with the HAL handles of the project.
+ */
+
+#ifndef PORT_INC_PORT_H_
+#define PORT_INC_PORT_H_
+
+#include "main.h"
+#include <stdint.h>
+
+#if defined(STM32F0) || defined(STM32F1)
+
+/**
+ * @brief Drive an output pin, one store to BSRR (no read-modify-write)
+ * @param port GPIO port
+ * @param pin GPIO_PIN_x mask
+ * @param state 0 low, else high
+ */
+static inline void Port_Pin_Write(GPIO_TypeDef *port, uint16_t pin, uint8_t state)
+{
+    port->BSRR = state ? (uint32_t)pin : (uint32_t)pin << 16;
+}
+
+/**
+ * @brief Core clock cycles from SysTick and the HAL tick, wraps every 2^32
+ *        cycles (89 s at 48 MHz). Works on every Cortex-M, unlike DWT.
+ *        Thread mode only: a tick held back by masked interrupts reads 1 ms late.
+ */
+static inline uint32_t Port_Cycles(void)
+{
+    uint32_t tick, val;
+
+    /* SysTick counts down from LOAD once per HAL tick, read the tick again
+       in case it moved while VAL was read */
+    do
+    {
+        tick = HAL_GetTick();
+        val = SysTick->VAL;
+    } while (tick != HAL_GetTick());
+
+    return tick * (SysTick->LOAD + 1) + (SysTick->LOAD - val);
+}
+
+/**
+ * @brief Level of an input pin, 1 if high
+ */
+static inline uint8_t Port_Pin_Read(GPIO_TypeDef *port, uint16_t pin)
+{
+    return (port->IDR & pin) != 0;
+}
+
+/**
+ * @brief Send one byte and wait until it has left the shift register, so
+ *        the caller can raise CS right after
+ * @param spi Enabled on the first call if needed
+ */
+static inline void Port_SPI_Write(SPI_TypeDef *spi, uint8_t value)
+{
+    spi->CR1 |= SPI_CR1_SPE;
+    while (!(spi->SR & SPI_SR_TXE));
+#if defined(STM32F0)
+    /* byte access, a half-word store would queue two bytes (data packing) */
+    *(volatile uint8_t *)&spi->DR = value;
+#else
+    spi->DR = value;
+#endif
+    while (!(spi->SR & SPI_SR_TXE));
+    while (spi->SR & SPI_SR_BSY);
+
+    /* transmit only, drop the byte clocked in and the overrun it may leave */
+#if defined(STM32F0)
+    while (spi->SR & SPI_SR_FRLVL)
+        (void)*(volatile uint8_t *)&spi->DR;
+#else
+    (void)spi->DR;
+#endif
+    (void)spi->SR;
+}
+
+/**
+ * @brief Blocking UART transmit, returns once the last stop bit is sent
+ * @param uart Initialized by the HAL (MX_USARTx_UART_Init)
+ */
+static inline void Port_UART_Write(USART_TypeDef *uart, const uint8_t *data, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++)
+    {
+#if defined(STM32F0)
+        while (!(uart->ISR & USART_ISR_TXE));
+        uart->TDR = data[i];
+#else
+        while (!(uart->SR & USART_SR_TXE));
+        uart->DR = data[i];
+#endif
+    }
+#if defined(STM32F0)
+    while (!(uart->ISR & USART_ISR_TC));
+#else
+    while (!(uart->SR & USART_SR_TC));
+#endif
+}
+
+/**
+ * @brief Take a received byte if there is one, without waiting
+ * @retval 1 if *byte was written, 0 if nothing was received
+ */
+static inline uint8_t Port_UART_Read(USART_TypeDef *uart, uint8_t *byte)
+{
+#if defined(STM32F0)
+    uart->ICR = USART_ICR_ORECF; // an overrun would stop reception
+    if (!(uart->ISR & USART_ISR_RXNE))
+        return 0;
+    *byte = (uint8_t)uart->RDR;
+#else
+    if (!(uart->SR & USART_SR_RXNE))
+        return 0;
+    *byte = (uint8_t)uart->DR; // SR then DR also clears an overrun
+#endif
+    return 1;
+}
+
+#elif defined(PORT_HOST)
+
+/* host builds (simulator, tests) provide the same functions */
+#include "port_host.h"
+
+#else
+#error "port.h: no port for this MCU family"
+#endif
+
+#endif /* PORT_INC_PORT_H_ */
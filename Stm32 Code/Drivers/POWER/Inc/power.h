@@ -0,0 +1,33 @@
+/*
+ * power.h
+ *
+ *  Public interface of the low-power idle.
+ *  The main loop runs once per event and calls Power_Idle when it is done.
+ *  The core then stops until an interrupt handler calls Power_Wake: the RTC
+ *  minute alarm or the end of the panel BUSY. Both come through EXTI lines,
+ *  which are the only wake up sources of the STOP mode.
+ *
+ *  STOP turns off the HSE and the PLL, Power_Idle runs the clock
+ *  configuration again on wake up and moves the HAL tick on by the time
+ *  spent stopped (measured with the RTC).
+ */
+
+#ifndef POWER_INC_POWER_H_
+#define POWER_INC_POWER_H_
+
+#include <stdint.h>
+
+typedef enum
+{
+	POWER_SLEEP = 0, // __WFI, back on any interrupt (SysTick included), DMA and UART keep running
+	POWER_STOP       // every clock stopped until Power_Wake, only EXTI lines wake up
+} Power_Mode;
+
+/* Sets the system clock again, e.g. SystemClock_Config from CubeMX */
+typedef void (*Power_Clock_Config)(void);
+
+void Power_Init(Power_Clock_Config config);
+void Power_Wake(void);
+void Power_Idle(Power_Mode mode);
+
+#endif /* POWER_INC_POWER_H_ */
@@ -0,0 +1,106 @@
+/*
+ * power.c
+ *
+ *  Description:
+ *  Low-power idle between the events of the main loop, see power.h.
+ *
+ *  Interrupts are masked while the wake flag is checked: an interrupt
+ *  coming after the check stays pending and ends the __WFI at once, it is
+ *  never lost. Its handler runs when they are unmasked, after the clocks
+ *  are back.
+ */
+
+#include "power.h"
+#include "main.h"
+#include "clock.h"
+#include "energy.h"
+
+#define POWER_DAY_MS 86400000UL
+
+static volatile uint8_t power_wake = 0;
+static Power_Clock_Config power_clock_config = NULL;
+
+/**
+ * @brief  Call once at boot, after the clock configuration.
+ * @param  config: sets the system clock again after STOP
+ */
+void Power_Init(Power_Clock_Config config)
+{
+	power_clock_config = config;
+
+	RCC->APB1ENR |= RCC_APB1ENR_PWREN;
+	(void)RCC->APB1ENR;
+
+#ifdef DEBUG
+	/* keep the debugger connected in STOP */
+#if defined(STM32F0)
+	RCC->APB2ENR |= RCC_APB2ENR_DBGMCUEN;
+#endif
+	DBGMCU->CR |= DBGMCU_CR_DBG_STOP;
+#endif
+}
+
+/**
+ * @brief  The main loop has work, call from the interrupt handlers.
+ */
+void Power_Wake(void)
+{
+	power_wake = 1;
+}
+
+/**
+ * @brief  STOP with the regulator in low-power mode, interrupts masked.
+ */
+static void Power_Stop(void)
+{
+	uint32_t start = Clock_Ms_Of_Day();
+
+	HAL_SuspendTick();
+	PWR->CR &= ~PWR_CR_PDDS;
+	PWR->CR |= PWR_CR_LPDS;
+	SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+	__WFI();
+	SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+
+	/* the core woke up on the HSI, the HSE and the PLL are off */
+	if (power_clock_config != NULL)
+		power_clock_config();
+	HAL_ResumeTick();
+
+	uint32_t now = Clock_Ms_Of_Day();
+	uint32_t ms = now >= start ? now - start : now + POWER_DAY_MS - start;
+
+	uwTick += ms; // SysTick did not count while stopped
+	ENERGY_ADD_MS(ENERGY_CPU_STOP, ms);
+}
+
+/**
+ * @brief  Wait for the next event.
+ * @param  mode: POWER_STOP returns after a Power_Wake, POWER_SLEEP after
+ *         any interrupt (use it while a DMA transfer or a polled UART runs)
+ */
+void Power_Idle(Power_Mode mode)
+{
+	for (;;)
+	{
+		__disable_irq();
+		if (power_wake)
+		{
+			power_wake = 0;
+			__enable_irq();
+			return;
+		}
+
+		if (mode == POWER_STOP)
+		{
+			Power_Stop();
+			__enable_irq();
+		}
+		else
+		{
+			ENERGY_SLEEP();
+			__enable_irq();
+			return;
+		}
+	}
+}
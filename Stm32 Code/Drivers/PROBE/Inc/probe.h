@@ -0,0 +1,72 @@
+/*
+ * probe.h
+ *
+ *  Public interface of the cycle probes.
+ *  PROBE_BEGIN / PROBE_END around a code path count the CPU cycles it takes
+ *  and keep, per probe, the call count, min, max, mean and a histogram in
+ *  RAM. Probe_Dump writes them as text, tools/probe_report.py turns the dump
+ *  into a report.
+ *
+ *  Cycles come from the DWT cycle counter on Cortex-M3 (F103), from SysTick
+ *  and the HAL tick on Cortex-M0 (F072), which has no DWT.
+ *
+ *  Build with PROBE_ENABLE=1 to enable them, the macros compile to nothing
+ *  otherwise.
+ */
+
+#ifndef PROBE_INC_PROBE_H_
+#define PROBE_INC_PROBE_H_
+
+#include <stdint.h>
+
+#ifndef PROBE_ENABLE
+#define PROBE_ENABLE 0
+#endif
+
+#define PROBE_BUCKETS 16 // histogram bucket b counts calls of 4^b to 4^(b+1) - 1 cycles
+
+/* Measured code paths */
+typedef enum
+{
+	PROBE_PARTIAL_DISPLAY = 0, // EPAPER_KW_Partial_Display
+	PROBE_SIZE_MULT,           // EPAPER_Size_Mult
+	PROBE_BME_READ,            // BME_Read_Data
+	PROBE_AT_COMMAND,          // Send_ATCMD_DMA
+	PROBE_MOON_PHASE,          // Moon_Phase
+	PROBE_TZ_LOCAL,            // TZ_Local
+	PROBE_COUNT
+} Probe_Id;
+
+/* Statistics of one probe, in cycles */
+typedef struct
+{
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+	uint16_t histogram[PROBE_BUCKETS]; // saturates at 65535
+} Probe_Stats;
+
+/* Writes len characters of a dump, e.g. to a UART */
+typedef void (*Probe_Writer)(const char *text, uint16_t len);
+
+#if PROBE_ENABLE
+
+void Probe_Init(void);
+void Probe_Begin(Probe_Id id);
+void Probe_End(Probe_Id id);
+const Probe_Stats *Probe_Get_Stats(Probe_Id id);
+void Probe_Dump(Probe_Writer write);
+void Probe_Reset(void);
+
+#define PROBE_BEGIN(id) Probe_Begin(id)
+#define PROBE_END(id) Probe_End(id)
+
+#else
+
+#define PROBE_BEGIN(id) ((void)0)
+#define PROBE_END(id) ((void)0)
+
+#endif
+
+#endif /* PROBE_INC_PROBE_H_ */
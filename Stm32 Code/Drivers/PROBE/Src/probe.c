@@ -0,0 +1,144 @@
+/*
+ * probe.c
+ *
+ *  Description:
+ *  Cycle probes around the hot paths of the firmware, see probe.h.
+ */
+
+#include "probe.h"
+
+#if PROBE_ENABLE
+
+#include "main.h"
+#include "port.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *const probe_names[PROBE_COUNT] = {
+	"partial_display",
+	"size_mult",
+	"bme_read",
+	"at_command",
+	"moon_phase",
+	"tz_local",
+};
+
+static Probe_Stats probe_stats[PROBE_COUNT];
+static uint32_t probe_start[PROBE_COUNT];
+static uint32_t probe_overhead = 0; // cycles of an empty begin/end pair
+
+/**
+ * @brief  Free running cycle count, wraps every 2^32 cycles (89 s at 48 MHz).
+ */
+static inline uint32_t Probe_Cycles(void)
+{
+#if (__CORTEX_M >= 3U)
+	return DWT->CYCCNT;
+#else
+	return Port_Cycles();
+#endif
+}
+
+/**
+ * @brief  Start the cycle counter and measure the probe overhead,
+ *         call once after HAL_Init.
+ */
+void Probe_Init(void)
+{
+#if (__CORTEX_M >= 3U)
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+	probe_overhead = 0;
+	Probe_Reset();
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		Probe_Begin(PROBE_PARTIAL_DISPLAY);
+		Probe_End(PROBE_PARTIAL_DISPLAY);
+	}
+	probe_overhead = probe_stats[PROBE_PARTIAL_DISPLAY].min;
+	Probe_Reset();
+}
+
+/**
+ * @brief  Entry of a measured path.
+ */
+void Probe_Begin(Probe_Id id)
+{
+	probe_start[id] = Probe_Cycles();
+}
+
+/**
+ * @brief  Exit of a measured path, adds one sample to its statistics.
+ */
+void Probe_End(Probe_Id id)
+{
+	uint32_t cycles = Probe_Cycles() - probe_start[id];
+	Probe_Stats *s = &probe_stats[id];
+	uint8_t bucket = 0;
+
+	cycles = cycles > probe_overhead ? cycles - probe_overhead : 0;
+
+	if (s->count == 0 || cycles < s->min) s->min = cycles;
+	if (cycles > s->max) s->max = cycles;
+	s->count++;
+	s->sum += cycles;
+
+	for (uint32_t c = cycles; c >= 4 && bucket < PROBE_BUCKETS - 1; c >>= 2)
+		bucket++;
+	if (s->histogram[bucket] != UINT16_MAX) s->histogram[bucket]++;
+}
+
+/**
+ * @brief  Statistics of one probe since the last reset.
+ */
+const Probe_Stats *Probe_Get_Stats(Probe_Id id)
+{
+	return &probe_stats[id];
+}
+
+/**
+ * @brief  Write the statistics as text, one line per probe.
+ * @param  write Output, called several times per line
+ *
+ * Format read by tools/probe_report.py:
+ *   PROBE <probes> <core clock Hz>
+ *   P <name> <count> <min> <max> <mean> <bucket 0> ... <bucket 15>
+ *   PROBE_END
+ */
+void Probe_Dump(Probe_Writer write)
+{
+	char line[64];
+	int len;
+
+	len = snprintf(line, sizeof(line), "PROBE %u %lu\r\n", PROBE_COUNT, (unsigned long)SystemCoreClock);
+	write(line, len);
+	for (uint8_t id = 0; id < PROBE_COUNT; id++)
+	{
+		const Probe_Stats *s = &probe_stats[id];
+		uint32_t mean = s->count ? (uint32_t)(s->sum / s->count) : 0;
+
+		len = snprintf(line, sizeof(line), "P %s %lu %lu %lu %lu", probe_names[id],
+				(unsigned long)s->count, (unsigned long)s->min, (unsigned long)s->max, (unsigned long)mean);
+		write(line, len);
+		for (uint8_t b = 0; b < PROBE_BUCKETS; b++)
+		{
+			len = snprintf(line, sizeof(line), " %u", s->histogram[b]);
+			write(line, len);
+		}
+		write("\r\n", 2);
+	}
+	write("PROBE_END\r\n", 11);
+}
+
+/**
+ * @brief  Clear the statistics of every probe.
+ */
+void Probe_Reset(void)
+{
+	memset(probe_stats, 0, sizeof(probe_stats));
+}
+
+#endif
@@ -0,0 +1,36 @@
+/*
+ * scratch.h
+ *
+ *  Public interface of the scratch memory module.
+ *  This module provides:
+ *   - A static scratch arena, borrowed by the EPAPER and ESP01 modules for
+ *     their large temporary buffers instead of the stack
+ *   - Stack painting at boot, to measure the deepest stack use
+ */
+
+#ifndef SCRATCH_INC_SCRATCH_H_
+#define SCRATCH_INC_SCRATCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SCRATCH_SIZE 1088 // bytes, biggest user is Init_Wifi (2 x ESP01_RESP_SIZE + headers)
+
+/* Memory usage since boot */
+typedef struct
+{
+	uint32_t stack_size;        // bytes between the heap reserve and _estack
+	uint32_t stack_peak;        // deepest stack use since Stack_Paint
+	uint32_t scratch_size;
+	uint32_t scratch_peak;      // most arena bytes in use at once
+	uint32_t scratch_failures;  // refused allocations and broken guard words
+} Mem_Report;
+
+void *Scratch_Alloc(size_t size);
+size_t Scratch_Mark(void);
+int Scratch_Release(size_t mark);
+void Stack_Paint(void);
+uint32_t Stack_Peak(void);
+void Mem_Get_Report(Mem_Report *report);
+
+#endif /* SCRATCH_INC_SCRATCH_H_ */
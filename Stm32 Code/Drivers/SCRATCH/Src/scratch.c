@@ -0,0 +1,144 @@
+/*
+ * scratch.c
+ *
+ *  Description:
+ *  Static scratch arena and stack high-water measurement.
+ *
+ *  The arena works as a stack: take a mark, allocate what the function
+ *  needs, release back to the mark before returning. Each block is framed
+ *  by its size and followed by a guard word, the guards are checked on
+ *  release so an overrun is counted instead of silently corrupting memory.
+ */
+
+#include "scratch.h"
+#include "main.h"
+
+#define SCRATCH_GUARD 0x5CA7C4EDu
+#define STACK_PATTERN 0xA5A5A5A5u
+#define STACK_MARGIN 64 // bytes below the current SP left alone by Stack_Paint
+
+/* Linker script symbols, only their addresses are used (as uintptr_t) */
+extern uint8_t _end;            // end of .bss, the heap starts here
+extern uint8_t _estack;         // top of the stack
+extern uint8_t _Min_Heap_Size;  // absolute symbol, its address is the value
+
+static uint32_t scratch_pool[SCRATCH_SIZE / 4];
+static size_t scratch_top = 0;      // bytes in use
+static size_t scratch_peak = 0;
+static uint32_t scratch_failures = 0;
+
+static uint32_t *stack_bottom = NULL;
+
+/**
+ * @brief  Borrow a block from the scratch arena.
+ * @param  size Number of bytes, rounded up to a multiple of 4.
+ * @retval Pointer to the block, NULL if the arena is full.
+ */
+void *Scratch_Alloc(size_t size)
+{
+	size_t words = (size + 3) / 4;
+	size_t need = (words + 2) * 4; /* size word + data + guard word */
+
+	if (need > SCRATCH_SIZE - scratch_top)
+	{
+		scratch_failures++;
+		return NULL;
+	}
+
+	uint32_t *block = &scratch_pool[scratch_top / 4];
+	block[0] = words;
+	block[1 + words] = SCRATCH_GUARD;
+
+	scratch_top += need;
+	if (scratch_top > scratch_peak) scratch_peak = scratch_top;
+
+	return &block[1];
+}
+
+/**
+ * @brief  Current top of the arena, to be given back to Scratch_Release.
+ */
+size_t Scratch_Mark(void)
+{
+	return scratch_top;
+}
+
+/**
+ * @brief  Free every block allocated since mark.
+ * @param  mark Value returned by Scratch_Mark.
+ *
+ * @retval 0  Success
+ * @retval -1 Bad mark or a block was written past its end
+ */
+int Scratch_Release(size_t mark)
+{
+	int ret = 0;
+
+	if (mark > scratch_top || (mark & 3))
+	{
+		scratch_failures++;
+		return -1;
+	}
+
+	for (size_t pos = mark; pos < scratch_top; )
+	{
+		uint32_t words = scratch_pool[pos / 4];
+		if (pos + (words + 2) * 4 > scratch_top || scratch_pool[pos / 4 + 1 + words] != SCRATCH_GUARD)
+		{
+			scratch_failures++;
+			ret = -1;
+			break;
+		}
+		pos += (words + 2) * 4;
+	}
+
+	scratch_top = mark;
+	return ret;
+}
+
+/**
+ * @brief  Fill the free stack with a pattern, call first thing in main().
+ *         The area starts after the heap reserve (_end + _Min_Heap_Size),
+ *         a heap growing past its reserve shows up as stack use.
+ */
+void Stack_Paint(void)
+{
+	uint32_t *p = (uint32_t *)(((uintptr_t)&_end + (uintptr_t)&_Min_Heap_Size + 3) & ~(uintptr_t)3);
+	uint32_t *sp = (uint32_t *)((uintptr_t)__get_MSP() - STACK_MARGIN);
+
+	stack_bottom = p;
+	while (p < sp)
+	{
+		*p++ = STACK_PATTERN;
+	}
+}
+
+/**
+ * @brief  Deepest stack use since Stack_Paint.
+ * @retval Bytes, 0 if the stack was not painted.
+ */
+uint32_t Stack_Peak(void)
+{
+	uint32_t *p = stack_bottom;
+
+	if (p == NULL) return 0;
+
+	while (p < (uint32_t *)&_estack && *p == STACK_PATTERN)
+	{
+		p++;
+	}
+	return (uint32_t)((uintptr_t)&_estack - (uintptr_t)p);
+}
+
+/**
+ * @brief  Collect the stack and arena figures.
+ * @param  report Output.
+ */
+void Mem_Get_Report(Mem_Report *report)
+{
+	report->stack_size = stack_bottom ? (uint32_t)((uintptr_t)&_estack - (uintptr_t)stack_bottom) : 0;
+	report->stack_peak = Stack_Peak();
+	report->scratch_size = SCRATCH_SIZE;
+	report->scratch_peak = scratch_peak;
+	report->scratch_failures = scratch_failures;
+}
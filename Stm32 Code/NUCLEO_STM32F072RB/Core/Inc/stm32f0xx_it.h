@@ -51,10 +51,11 @@ void HardFault_Handler(void);
 void SVC_Handler(void);
 void PendSV_Handler(void);
 void SysTick_Handler(void);
-void DMA1_Channel2_3_IRQHandler(void);
+void DMA1_Channel4_5_6_7_IRQHandler(void);
 void TIM3_IRQHandler(void);
 /* USER CODE BEGIN EFP */
-
+void DMA1_Channel2_3_IRQHandler(void);
+void EXTI0_1_IRQHandler(void);
 /* USER CODE END EFP */
 
 #ifdef __cplusplus
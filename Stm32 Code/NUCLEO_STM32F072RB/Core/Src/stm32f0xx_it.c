@@ -22,6 +22,10 @@
 #include "stm32f0xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "DRIVER.h"
+#include "backup.h"
+#include "clock.h"
+#include "power.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -41,7 +45,7 @@
 
 /* Private variables ---------------------------------------------------------*/
 /* USER CODE BEGIN PV */
-extern uint16_t minute;
+
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -142,17 +146,17 @@ void SysTick_Handler(void)
 /******************************************************************************/
 
 /**
-  * @brief This function handles DMA1 channel 2 and 3 interrupts.
+  * @brief This function handles DMA1 channel 4, 5, 6 and 7 interrupts.
   */
-void DMA1_Channel2_3_IRQHandler(void)
+void DMA1_Channel4_5_6_7_IRQHandler(void)
 {
-  /* USER CODE BEGIN DMA1_Channel2_3_IRQn 0 */
+  /* USER CODE BEGIN DMA1_Channel4_5_6_7_IRQn 0 */
 
-  /* USER CODE END DMA1_Channel2_3_IRQn 0 */
+  /* USER CODE END DMA1_Channel4_5_6_7_IRQn 0 */
   HAL_DMA_IRQHandler(&hdma_usart1_rx);
-  /* USER CODE BEGIN DMA1_Channel2_3_IRQn 1 */
+  /* USER CODE BEGIN DMA1_Channel4_5_6_7_IRQn 1 */
 
-  /* USER CODE END DMA1_Channel2_3_IRQn 1 */
+  /* USER CODE END DMA1_Channel4_5_6_7_IRQn 1 */
 }
 
 /**
@@ -161,7 +165,7 @@ void DMA1_Channel2_3_IRQHandler(void)
 void TIM3_IRQHandler(void)
 {
   /* USER CODE BEGIN TIM3_IRQn 0 */
-  minute++;
+
   /* USER CODE END TIM3_IRQn 0 */
   HAL_TIM_IRQHandler(&htim3);
   /* USER CODE BEGIN TIM3_IRQn 1 */
@@ -170,5 +174,38 @@ void TIM3_IRQHandler(void)
 }
 
 /* USER CODE BEGIN 1 */
+/**
+  * @brief This function handles DMA1 channel 2 and 3 interrupts (e-paper SPI1_TX, end of transfer).
+  */
+void DMA1_Channel2_3_IRQHandler(void)
+{
+  EPAPER_Transfer_IRQHandler();
+}
+
+/**
+  * @brief This function handles EXTI line 0 and 1 interrupts (e-paper BUSY released).
+  */
+void EXTI0_1_IRQHandler(void)
+{
+  EPAPER_Busy_IRQHandler();
+  Power_Wake();
+}
+
+/**
+  * @brief This function handles PVD and VDDIO2 supply comparator interrupts through EXTI lines 16 and 31 (supply falling, save the warm restart state).
+  */
+void PVD_VDDIO2_IRQHandler(void)
+{
+  Backup_PVD_IRQHandler();
+}
+
+/**
+  * @brief This function handles RTC interrupts through EXTI lines 17, 19 and 20 (real minute boundary).
+  */
+void RTC_IRQHandler(void)
+{
+  Clock_Alarm_IRQHandler();
+  Power_Wake();
+}
 
 /* USER CODE END 1 */
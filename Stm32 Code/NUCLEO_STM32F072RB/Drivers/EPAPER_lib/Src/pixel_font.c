@@ -1,590 +0,0 @@
-/*
- * pixel_font.c
- *
- *  Created on: Oct 25, 2025
- *      Author: valentin
- */
-
-#include "pixel_font.h"
-
-const uint8_t bpixel [] =
-{
-	// Character: '0'
-	0b11000001,
-	0b10111010,
-	0b10110110,
-	0b10101110,
-	0b11000001,
-
-	// Character: '1'
-	0b11111111,
-	0b10111101,
-	0b10000000,
-	0b10111111,
-	0b11111111,
-
-	//Character: 2
-	0b10111101,
-	0b10011110,
-	0b10101110,
-	0b10110110,
-	0b10111001,
-
-	//Character: 3
-	0b11011101,
-	0b10111110,
-	0b10110110,
-	0b10110110,
-	0b11001001,
-
-	//Character: 4
-	0b11100111,
-	0b11101011,
-	0b11101101,
-	0b11101110,
-	0b10000000,
-
-	//Character: 5
-	0b10110000,
-	0b10110110,
-	0b10110110,
-	0b10110110,
-	0b11001110,
-
-	//Character: 6
-	0b11000001,
-	0b10110110,
-	0b10110110,
-	0b10110110,
-	0b11001101,
-
-	//Character: 7
-	0b11111110,
-	0b11111110,
-	0b10011110,
-	0b11100110,
-	0b11111000,
-
-	//Character: 8
-	0b11001001,
-	0b10110110,
-	0b10110110,
-	0b10110110,
-	0b11001001,
-
-	//Character: 9
-	0b10111001,
-	0b10110110,
-	0b10110110,
-	0b10110110,
-	0b11000001,
-
-	//Character: A (+10)
-	0b10000001,
-	0b11110110,
-	0b11110110,
-	0b11110110,
-	0b10000001,
-
-	//Character: B
-	0b10000000,
-	0b10110110,
-	0b10110110,
-	0b10110110,
-	0b11001001,
-
-	//Character: C
-	0b11000001,
-	0b10111110,
-	0b10111110,
-	0b10111110,
-	0b11011101,
-
-	//Character: D
-	0b10000000,
-	0b10111110,
-	0b10111110,
-	0b10111110,
-	0b11000001,
-
-	//Character: E
-	0b10000000,
-	0b10110110,
-	0b10110110,
-	0b10111110,
-	0b10111110,
-
-	//Character: F
-	0b10000000,
-	0b11110110,
-	0b11110110,
-	0b11110110,
-	0b11111110,
-
-	//Character: G
-	0b11000001,
-	0b10111110,
-	0b10110110,
-	0b10110110,
-	0b10000101,
-
-	//Character: H
-	0b10000000,
-	0b11110111,
-	0b11110111,
-	0b11110111,
-	0b10000000,
-
-	//Character: I
-	0b11111111,
-	0b10111110,
-	0b10000000,
-	0b10111110,
-	0b11111111,
-
-	//Character: J
-	0b11011111,
-	0b10111110,
-	0b10111110,
-	0b11000000,
-	0b11111110,
-
-	//Character: K
-	0b10000000,
-	0b11110111,
-	0b11101011,
-	0b11011101,
-	0b10111110,
-
-	//Character: L
-	0b10000000,
-	0b10111111,
-	0b10111111,
-	0b10111111,
-	0b10111111,
-
-	//Character: M
-	0b10000000,
-	0b11111101,
-	0b11110011,
-	0b11111101,
-	0b10000000,
-
-	//Character: N
-	0b10000000,
-	0b11111011,
-	0b11110111,
-	0b11101111,
-	0b10000000,
-
-	//Character: O
-	0b11000001,
-	0b10111110,
-	0b10111110,
-	0b10111110,
-	0b11000001,
-
-	//Character: P
-	0b10000000,
-	0b11110110,
-	0b11110110,
-	0b11110110,
-	0b11111001,
-
-	//Character: Q
-	0b11000001,
-	0b10111110,
-	0b10101110,
-	0b11011110,
-	0b10100001,
-
-	//Character: R
-	0b10000000,
-	0b11110110,
-	0b11110110,
-	0b11110110,
-	0b10001001,
-
-	//Character: S
-	0b11011001,
-	0b10110110,
-	0b10110110,
-	0b10110110,
-	0b11001101,
-
-	//Character: T
-	0b11111110,
-	0b11111110,
-	0b10000000,
-	0b11111110,
-	0b11111110,
-
-	//Character: U
-	0b11000000,
-	0b10111111,
-	0b10111111,
-	0b10111111,
-	0b11000000,
-
-	//Character: V
-	0b11111000,
-	0b11000111,
-	0b10111111,
-	0b11000111,
-	0b11111000,
-
-	//Character: W
-	0b11000000,
-	0b10111111,
-	0b11000111,
-	0b10111111,
-	0b11000000,
-
-	//Character: X
-	0b10011100,
-	0b11101011,
-	0b11110111,
-	0b11101011,
-	0b10011100,
-
-	//Character: Y
-	0b11111000,
-	0b11110111,
-	0b10001111,
-	0b11110111,
-	0b11111000,
-
-	//Character: Z
-	0b10011110,
-	0b10101110,
-	0b10110110,
-	0b10111010,
-	0b10111100,
-
-	//Character: a (+36)
-	0b11000111,
-	0b10111011,
-	0b10111011,
-	0b10110111,
-	0b10000011,
-
-	//Character: b
-	0b10000000,
-	0b10111011,
-	0b10111011,
-	0b10111011,
-	0b11000111,
-
-	//Character: c
-	0b11000111,
-	0b10111011,
-	0b10111011,
-	0b10111011,
-	0b11010111,
-
-	//Character: d
-	0b11000111,
-	0b10111011,
-	0b10111011,
-	0b10111011,
-	0b10000000,
-
-	//Character: e
-	0b11000111,
-	0b10101011,
-	0b10101011,
-	0b10101011,
-	0b11100111,
-
-	//Character: f
-	0b11111111,
-	0b11111011,
-	0b10000001,
-	0b11111010,
-	0b11111010,
-
-	//Character: g
-	0b11100011,
-	0b01011101,
-	0b01011101,
-	0b01101101,
-	0b10000011,
-
-	//Character: h
-	0b10000000,
-	0b11110111,
-	0b11111011,
-	0b11111011,
-	0b10000111,
-
-	//Character: i
-	0b11111111,
-	0b11111111,
-	0b10000010,
-	0b11111111,
-	0b11111111,
-
-
-	//Character: j
-	0b11111111,
-	0b01111111,
-	0b10000010,
-	0b11111111,
-	0b11111111,
-
-	//Character: k
-	0b10000000,
-	0b11101011,
-	0b11001011,
-	0b10101011,
-	0b11110111,
-
-	//Character: l
-	0b11111111,
-	0b11111111,
-	0b11000000,
-	0b10111111,
-	0b11111111,
-	//Character: m
-	0b10000011,
-	0b11111011,
-	0b11000111,
-	0b11111011,
-	0b10000111,
-
-	//Character: n
-	0b10000011,
-	0b11110111,
-	0b11111011,
-	0b11111011,
-	0b10000111,
-
-	//Character: o
-	0b11000111,
-	0b10111011,
-	0b10111011,
-	0b10111011,
-	0b11000111,
-
-	//Character: p
-	0b00000001,
-	0b11011011,
-	0b11011101,
-	0b11011101,
-	0b11100011,
-
-	//Character: q
-	0b11100011,
-	0b11011101,
-	0b11011101,
-	0b11011011,
-	0b00000001,
-
-	//Character: r
-	0b10000011,
-	0b11110111,
-	0b11111011,
-	0b11111011,
-	0b11110111,
-
-	//Character: s
-	0b10110111,
-	0b10101011,
-	0b10101011,
-	0b10101011,
-	0b11011011,
-
-	//Character: t
-	0b11111111,
-	0b11111011,
-	0b10000000,
-	0b11111011,
-	0b11111111,
-
-	//Character: u
-	0b11000011,
-	0b10111111,
-	0b10111111,
-	0b11011111,
-	0b10000011,
-
-	//Character: v
-	0b11110011,
-	0b11001111,
-	0b10111111,
-	0b11001111,
-	0b11110011,
-
-	//Character: w
-	0b11000011,
-	0b10111111,
-	0b11001111,
-	0b10111111,
-	0b11000011,
-
-	//Character: x
-	0b10111011,
-	0b11010111,
-	0b11101111,
-	0b11010111,
-	0b10111011,
-
-	//Character: y
-	0b11110001,
-	0b01101111,
-	0b01101111,
-	0b01110111,
-	0b10000001,
-
-	//Character: z
-	0b10111011,
-	0b10011011,
-	0b10101011,
-	0b10110011,
-	0b10111011,
-
-	//Character: ° (+62)
-	0b11111111,
-	0b11111111,
-	0b11111000,
-	0b11111010,
-	0b11111000,
-
-	//Character: - (+63)
-	0b11110111,
-	0b11110111,
-	0b11110111,
-	0b11110111,
-	0b11110111,
-
-	//character: % (+64)
-	0b10001101,
-	0b10101011,
-	0b10010100,
-	0b11101010,
-	0b11011000,
-
-	//Character: space (+65)
-	0b11111111,
-	0b11111111,
-
-	//Character: , (+66)
-	0b00111111,
-	0b11111111,
-};
-
-
-const uint8_t icone [] =
-{
-	//soleil
-	0b11111111, 0b11111111,
-	0b11111111, 0b01111111,
-	0b11101111, 0b01111011,
-	0b11110111, 0b11110111,
-	0b11111110, 0b00111111,
-	0b11111101, 0b11011111,
-	0b11111011, 0b11101111,
-	0b11001011, 0b11101001,
-	0b11111011, 0b11101111,
-	0b11111101, 0b11011111,
-	0b11111110, 0b00111111,
-	0b11110111, 0b11110111,
-	0b11101111, 0b01111011,
-	0b11111111, 0b01111111,
-	0b11111111, 0b11111111,
-	0b11111111, 0b11111111,
-};
-
-const uint8_t moon [] =
-{
-	//new moon
-	0b11111111, 0b11111111,
-	0b11111100, 0b00111111,
-	0b11110000, 0b00001111,
-	0b11100000, 0b00000111,
-	0b11000000, 0b00000011,
-	0b11000000, 0b00000011,
-	0b10000000, 0b00000001,
-	0b10000000, 0b00000001,
-	0b10000000, 0b00000001,
-	0b10000000, 0b00000001,
-	0b11000000, 0b00000011,
-	0b11000000, 0b00000011,
-	0b11100000, 0b00000111,
-	0b11110000, 0b00001111,
-	0b11111100, 0b00111111,
-	0b11111111, 0b11111111,
-
-	//crescent moon
-	0b11111111, 0b11111111,
-	0b11111100, 0b00111111,
-	0b11110011, 0b11001111,
-	0b11101111, 0b11110111,
-	0b11011111, 0b11111011,
-	0b11011000, 0b00011011,
-	0b10100000, 0b00000101,
-	0b10000000, 0b00000001,
-	0b10000000, 0b00000001,
-	0b10000000, 0b00000001,
-	0b11000000, 0b00000011,
-	0b11000000, 0b00000011,
-	0b11100000, 0b00000111,
-	0b11110000, 0b00001111,
-	0b11111100, 0b00111111,
-	0b11111111, 0b11111111,
-
-	//half moon
-	0b11111111, 0b11111111,
-	0b11111100, 0b00111111,
-	0b11110011, 0b11001111,
-	0b11101111, 0b11110111,
-	0b11011111, 0b11111011,
-	0b11011111, 0b11111011,
-	0b10111111, 0b11111101,
-	0b10111111, 0b11111101,
-	0b10000000, 0b00000001,
-	0b10000000, 0b00000001,
-	0b11000000, 0b00000011,
-	0b11000000, 0b00000011,
-	0b11100000, 0b00000111,
-	0b11110000, 0b00001111,
-	0b11111100, 0b00111111,
-	0b11111111, 0b11111111,
-
-	//gibbous moon
-	0b11111111, 0b11111111,
-	0b11111100, 0b00111111,
-	0b11110011, 0b11001111,
-	0b11101111, 0b11110111,
-	0b11011111, 0b11111011,
-	0b11011111, 0b11111011,
-	0b10111111, 0b11111101,
-	0b10111111, 0b11111101,
-	0b10011111, 0b11111001,
-	0b10001111, 0b11110001,
-	0b11000011, 0b11000011,
-	0b11000000, 0b00000011,
-	0b11100000, 0b00000111,
-	0b11110000, 0b00001111,
-	0b11111100, 0b00111111,
-	0b11111111, 0b11111111,
-
-	//full moon
-	0b11111111, 0b11111111,
-	0b11111100, 0b00111111,
-	0b11110011, 0b11001111,
-	0b11101111, 0b11110111,
-	0b11011111, 0b11111011,
-	0b11011111, 0b11111011,
-	0b10111111, 0b11111101,
-	0b10111111, 0b11111101,
-	0b10111111, 0b11111101,
-	0b10111111, 0b11111101,
-	0b11011111, 0b11111011,
-	0b11011111, 0b11111011,
-	0b11101111, 0b11110111,
-	0b11110011, 0b11001111,
-	0b11111100, 0b00111111,
-	0b11111111, 0b11111111,
-
-};
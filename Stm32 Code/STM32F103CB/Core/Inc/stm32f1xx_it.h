@@ -58,7 +58,8 @@ void SysTick_Handler(void);
 void DMA1_Channel5_IRQHandler(void);
 void TIM3_IRQHandler(void);
 /* USER CODE BEGIN EFP */
-
+void DMA1_Channel7_IRQHandler(void);
+void EXTI0_IRQHandler(void);
 /* USER CODE END EFP */
 
 #ifdef __cplusplus
@@ -26,9 +26,18 @@
 #include <string.h>
 #include "ESP01_HAL.h"
 #include "date_converter.h"
+#include "time_zone.h"
 #include "DRIVER.h"
 #include "EPAPER.h"
+#include "EPAPER_Ghost.h"
+#include "EPAPER_Widget.h"
+#include "energy.h"
+#include "probe.h"
+#include "backup.h"
 #include "bme280.h"
+#include "clock.h"
+#include "power.h"
+#include "scratch.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -38,6 +47,9 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#define TEMP_ALERT_LOW 0     // 0.1 °C, red mark under the temperature outside this range
+#define TEMP_ALERT_HIGH 300
+#define SYNC_RETRY 60        // minutes before another try after a failed sync
 
 /* USER CODE END PD */
 
@@ -69,28 +81,34 @@ static void MX_USART1_UART_Init(void);
 static void MX_I2C1_Init(void);
 static void MX_SPI1_Init(void);
 /* USER CODE BEGIN PFP */
+static void Draw_Alerts(void);
+static void Set_Widgets(void);
+static void Get_State(Backup_State *state);
+static void Restore_State(const Backup_State *state);
+static void Save_State(void);
+static void Read_Clock(void);
+static void Sync_Clock(void);
 
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
 uint8_t day = 0;
-uint8_t prev_day = 0;
 uint8_t dd = 0;
 uint8_t mm = 0;
 uint16_t yy = 0;
 uint16_t minute = 0;
-uint16_t prev_minute = 0;
 uint8_t moon_phase = 0;
 
 int temp = 0;
-int prev_temp = 0;
 uint32_t press = 0;
-uint32_t prev_press = 0;
 uint32_t hum = 0;
-uint32_t prev_hum = 0;
 
-uint8_t wifi_update_done = 0;
+uint16_t sync_countdown = 0; // minutes to the next clock sync
+uint8_t temp_alert = 0;
+uint8_t sync_pending = 0;   // warm restart, sensor and clock not synced yet
+uint8_t fast_refresh = 0;   // the minute tick goes out with the fast waveform
+Mem_Report mem_report;
 /* USER CODE END 0 */
 
 /**
@@ -101,7 +119,7 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
-
+  Stack_Paint(); /* before anything else uses the stack */
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -128,42 +146,68 @@ int main(void)
   MX_I2C1_Init();
   MX_SPI1_Init();
   /* USER CODE BEGIN 2 */
-  if (HAL_TIM_Base_Start_IT(&htim3) != HAL_OK)
-  {
-      /* Starting Error */
-    Error_Handler();
-  }
-
-  BME_Init();
-  BME_Read_Data(&temp, &press, &hum);
+#if PROBE_ENABLE
+  Probe_Init();
+#endif
+#if ENERGY_ENABLE
+  Energy_Init();
+#endif
+  Power_Init(SystemClock_Config);
+  EPAPER_Transfer_Init();
+  EPAPER_Busy_Init();
+
+
+  /* the screen elements, drawn by the first EPAPER_Widget_Update */
+  EPAPER_Widget_Register(&EPAPER_widget_date);
+  EPAPER_Widget_Register(&EPAPER_widget_hour);
+  EPAPER_Widget_Register(&EPAPER_widget_sky);
+  EPAPER_Widget_Register(&EPAPER_widget_temp);
+  EPAPER_Widget_Register(&EPAPER_widget_press);
+  EPAPER_Widget_Register(&EPAPER_widget_hum);
+
+  /* the RTC keeps the time through resets, the backup registers the rest */
+  int clock_kept = Clock_Init();
+  Backup_State state;
+  Backup_Init();
+  if(Backup_Load(&state) == 0){
+	/* warm restart: the saved state is drawn at once with a single refresh,
+	   the sensor and the clock are synced by the loop while the panel works */
+	Restore_State(&state);
+	/* a lost RTC leaves the saved time on screen until the sync */
+	if(clock_kept == 0){
+		Read_Clock();
+	}
+	EPAPER_Set_Temperature(temp);
 
-  Init_Wifi("Wifi_name", "Wifi_pswd");
-  if(Get_Date(&day, &dd, &mm, &yy, &minute) == 0){
-	UTC_to_Paris(&day, &dd, &mm, &yy, &minute);
+	EPAPER_Part_Init();
+	if(temp_alert){
+		EPAPER_Red_Layer(Draw_Alerts);
+	}
+	Set_Widgets();
+	EPAPER_Restore_Display();
+	sync_pending = 1;
   }
-  prev_minute = minute + 1111;
-
-  moon_phase = Moon_Phase(dd,mm,yy);
-
-  EPAPER_Init();
-  EPAPER_Clear();
-  HAL_Delay(500);
-  EPAPER_Part_Init();
-  EPAPER_KW_White_Display();
-  HAL_Delay(500);
-
-  EPAPER_Print_temp(temp);
-  EPAPER_Print_press(press);
-  EPAPER_Print_hum(hum);
-  EPAPER_Print_Date(day,  dd, mm);
-  EPAPER_Print_Hour(minute,  prev_minute);
-  EPAPER_Print_Moon_Phase(moon_phase, minute, 360, 1080);
-
-  prev_minute = minute;
-  prev_day = day;
-  prev_temp = temp;
-  prev_hum = hum;
-  prev_press = press;
+  else{
+	BME_Init();
+	BME_Read_Data(&temp, &press, &hum);
+	EPAPER_Set_Temperature(temp);
+
+	Sync_Clock();
+
+	EPAPER_Init();
+	EPAPER_Clear();
+	HAL_Delay(500);
+	EPAPER_Part_Init();
+	EPAPER_KW_White_Display();
+	HAL_Delay(500);
+
+	Set_Widgets();
+	EPAPER_Widget_Update(NULL);
+	Save_State();
+  }
+
+  /* the last state is saved when the supply falls */
+  Backup_PVD_Init(Get_State);
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -171,81 +215,77 @@ int main(void)
   while (1)
   {
 
+	/* warm restart: the sync skipped by the boot runs during the first refresh */
+	if(sync_pending){
+		sync_pending = 0;
 
-	if(prev_minute != minute)
-	{
-		if(minute >= 1440){
-			minute = 0;
-			day++;
-		}
-
-		EPAPER_Print_Hour(minute,  prev_minute);
-		EPAPER_Print_Moon_Phase(moon_phase, minute, 360, 1080);
-		prev_minute = minute;
-
-		/* update temp hum and press each minute */
+		BME_Init();
 		BME_Read_Data(&temp, &press, &hum);
+		EPAPER_Set_Temperature(temp);
 
-		if(prev_temp != temp){
-			prev_temp = temp;
-			EPAPER_Print_temp(temp);
-		}
-		if(prev_press != press){
-			prev_press = press;
-			EPAPER_Print_press(press);
-		}
-		if(prev_hum != hum){
-			prev_hum = hum;
-			EPAPER_Print_hum(hum);
+		Sync_Clock();
+		Save_State();
+	}
+
+	/* the RTC alarm marks each real minute boundary, the RTC also rolls the date */
+	if(Clock_Minute_Elapsed()){
+		Read_Clock();
+		if(sync_countdown > 0){
+			sync_countdown--;
 		}
 	}
 
-	if(prev_day != day)
+	/* the hour widget sees the minute tick */
+	if(EPAPER_Widget_Set(&EPAPER_widget_hour, 0, minute) == 1)
 	{
-		if(day >= 7){
-			day = 0;
+		/* update temp hum and press each minute */
+		BME_Read_Data(&temp, &press, &hum);
+		EPAPER_Set_Temperature(temp);
+		Clock_Temperature(temp);
+
+		/* the red plane is slow to refresh, only touch it when the alert changes */
+		if(temp_alert != (temp < TEMP_ALERT_LOW || temp >= TEMP_ALERT_HIGH)){
+			temp_alert = !temp_alert;
+			EPAPER_Red_Layer(temp_alert ? Draw_Alerts : NULL);
 		}
-		prev_day = day;
 
-		next_day(&dd,&mm,&yy);
+		/* clean the zones worn out by partial refreshes, at night if it can wait */
+		EPAPER_Ghost_Tick();
+		fast_refresh = EPAPER_Ghost_Service(minute) == EPAPER_GHOST_NONE;
 
-		EPAPER_Print_Date(day,  dd, mm);
-		moon_phase = Moon_Phase(dd,mm,yy);
+		/* a reset from now on restarts with this minute */
+		Save_State();
 	}
 
-	/* reset screen every day at 4h*/
-	if((minute == 240 || minute == 600 || minute == 960 || minute == 1320) && !wifi_update_done){
-		wifi_update_done = 1;
+	/* resync the clock when the interval chosen from its drift is over,
+	   the screen cleaning is left to EPAPER_Ghost_Service */
+	if(sync_countdown == 0){
 
-		Init_Wifi("Wifi_name", "Wifi_pswd");
-		if(Get_Date(&day, &dd, &mm, &yy, &minute) == 0){
-			UTC_to_Paris(&day, &dd, &mm, &yy, &minute);
-		}
-		prev_minute = minute + 1111;
-
-		EPAPER_Init();
-		EPAPER_Clear();
-		HAL_Delay(500);
-		EPAPER_Part_Init();
-		EPAPER_KW_White_Display();
-		HAL_Delay(500);
-
-		EPAPER_Print_temp(temp);
-		EPAPER_Print_press(press);
-		EPAPER_Print_hum(hum);
-		EPAPER_Print_Date(day,  dd, mm);
-		EPAPER_Print_Hour(minute,  prev_minute);
-		EPAPER_Print_Moon_Phase(moon_phase, minute, 360, 1080);
-		prev_minute = minute;
-		prev_day = day;
-		prev_temp = temp;
-		prev_hum = hum;
-		prev_press = press;
+		/* the widgets redraw whatever the sync corrected */
+		Sync_Clock();
+		Save_State();
+
+		/* memory high-water marks, readable from the debugger */
+		Mem_Get_Report(&mem_report);
 	}
 
-	if(minute == 241 || minute == 601 || minute == 961 || minute == 1321){
-		wifi_update_done = 0;
+	/* the widgets whose value changed draw themselves (before a red refresh,
+	   which sends the whole frame) and go out with a single refresh, the
+	   panel works on it while the loop goes on */
+	Set_Widgets();
+	EPAPER_Widget_Draw();
+	if(!EPAPER_Red_Flush() && fast_refresh){
+		/* the minute tick only flips digits, its refresh uses the shortest
+		   waveform (a red flush or a zone cleaning keeps its own) */
+		EPAPER_Refresh_Mode(EPAPER_LUT_FAST);
 	}
+	fast_refresh = 0;
+	EPAPER_Widget_Update(NULL);
+	EPAPER_Refresh_Poll();
+
+	/* nothing left until the next event (RTC minute alarm, end of BUSY),
+	   the core stops in between */
+	Power_Idle(EPAPER_Transfer_Busy() ? POWER_SLEEP : POWER_STOP);
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
@@ -349,7 +389,7 @@ static void MX_SPI1_Init(void)
   hspi1.Init.CLKPolarity = SPI_POLARITY_LOW;
   hspi1.Init.CLKPhase = SPI_PHASE_1EDGE;
   hspi1.Init.NSS = SPI_NSS_SOFT;
-  hspi1.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_256;
+  hspi1.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_8;
   hspi1.Init.FirstBit = SPI_FIRSTBIT_MSB;
   hspi1.Init.TIMode = SPI_TIMODE_DISABLE;
   hspi1.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
@@ -497,6 +537,121 @@ static void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 4 */
+/**
+  * @brief  Red layer: a bar under the temperature while temp_alert is set
+  */
+static void Draw_Alerts(void)
+{
+	if(temp_alert){
+		EPAPER_Draw_Rect(218, 90, 132, 4, 0x00);
+	}
+}
+
+/**
+  * @brief  Give the current values to the screen widgets, those that change
+  *         are redrawn by the next EPAPER_Widget_Update
+  */
+static void Set_Widgets(void)
+{
+	EPAPER_Widget_Set(&EPAPER_widget_hour, 0, minute);
+	EPAPER_Widget_Set(&EPAPER_widget_date, 0, day);
+	EPAPER_Widget_Set(&EPAPER_widget_date, 1, dd);
+	EPAPER_Widget_Set(&EPAPER_widget_date, 2, mm);
+	EPAPER_Widget_Set(&EPAPER_widget_sky, 0, moon_phase);
+	EPAPER_Widget_Set(&EPAPER_widget_sky, 1, minute);
+	EPAPER_Widget_Set(&EPAPER_widget_temp, 0, temp);
+	EPAPER_Widget_Set(&EPAPER_widget_press, 0, press);
+	EPAPER_Widget_Set(&EPAPER_widget_hum, 0, hum);
+}
+
+/**
+  * @brief  Current values for a warm restart, also called from the PVD interrupt
+  */
+static void Get_State(Backup_State *state)
+{
+	state->minute = minute;
+	state->day = day;
+	state->dd = dd;
+	state->mm = mm;
+	state->yy = yy;
+	state->moon_phase = moon_phase;
+	state->temp = temp;
+	state->press = press;
+	state->hum = hum;
+	state->temp_alert = temp_alert;
+	state->clock_trim = Clock_Get_Trim();
+	state->zone = TZ_Get() + 1;
+}
+
+/**
+  * @brief  Values saved before the reset become the current ones
+  */
+static void Restore_State(const Backup_State *state)
+{
+	minute = state->minute;
+	day = state->day;
+	dd = state->dd;
+	mm = state->mm;
+	yy = state->yy;
+	moon_phase = state->moon_phase;
+	temp = state->temp;
+	press = state->press;
+	hum = state->hum;
+	temp_alert = state->temp_alert;
+	Clock_Set_Trim(state->clock_trim);
+	if(state->zone){
+		TZ_Select(state->zone - 1);
+	}
+}
+
+/**
+  * @brief  Save the current values in the backup registers
+  */
+static void Save_State(void)
+{
+	Backup_State state;
+
+	Get_State(&state);
+	Backup_Save(&state);
+}
+
+/**
+  * @brief  Take the date and time from the RTC, in the local time of the zone
+  */
+static void Read_Clock(void)
+{
+	Date_Time now;
+
+	Date_From_Epoch(TZ_Local(Clock_Get()), &now);
+	if(now.dd != dd || now.mm != mm || now.yy != yy){
+		moon_phase = Moon_Phase(now.dd, now.mm, now.yy);
+	}
+	day = now.day;
+	dd = now.dd;
+	mm = now.mm;
+	yy = now.yy;
+	minute = now.minute;
+}
+
+/**
+  * @brief  Set the RTC to the second from the network time, which also
+  *         measures its drift and gives the time to the next sync, then read
+  *         it back
+  */
+static void Sync_Clock(void)
+{
+	Date_Time now;
+
+	Init_Wifi("Wifi_name", "Wifi_pswd");
+	if(Get_Date(&now.day, &now.dd, &now.mm, &now.yy, &now.minute, &now.second) == 0){
+		Clock_Sync(Date_To_Epoch(&now));
+		sync_countdown = Clock_Sync_Interval();
+	}
+	else{
+		sync_countdown = SYNC_RETRY;
+	}
+	Read_Clock();
+}
 
 /* USER CODE END 4 */
 
@@ -22,6 +22,10 @@
 #include "stm32f1xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "DRIVER.h"
+#include "backup.h"
+#include "clock.h"
+#include "power.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -41,7 +45,7 @@
 
 /* Private variables ---------------------------------------------------------*/
 /* USER CODE BEGIN PV */
-extern uint16_t minute;
+
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -219,7 +223,7 @@ void DMA1_Channel5_IRQHandler(void)
 void TIM3_IRQHandler(void)
 {
   /* USER CODE BEGIN TIM3_IRQn 0 */
-  minute++;
+
   /* USER CODE END TIM3_IRQn 0 */
   HAL_TIM_IRQHandler(&htim3);
   /* USER CODE BEGIN TIM3_IRQn 1 */
@@ -228,5 +232,38 @@ void TIM3_IRQHandler(void)
 }
 
 /* USER CODE BEGIN 1 */
+/**
+  * @brief This function handles DMA1 channel7 global interrupt (e-paper CS pulses, end of transfer).
+  */
+void DMA1_Channel7_IRQHandler(void)
+{
+  EPAPER_Transfer_IRQHandler();
+}
+
+/**
+  * @brief This function handles EXTI line0 interrupt (e-paper BUSY released).
+  */
+void EXTI0_IRQHandler(void)
+{
+  EPAPER_Busy_IRQHandler();
+  Power_Wake();
+}
+
+/**
+  * @brief This function handles PVD interrupt through EXTI line16 (supply falling, save the warm restart state).
+  */
+void PVD_IRQHandler(void)
+{
+  Backup_PVD_IRQHandler();
+}
+
+/**
+  * @brief This function handles RTC alarm interrupt through EXTI line17 (real minute boundary).
+  */
+void RTC_Alarm_IRQHandler(void)
+{
+  Clock_Alarm_IRQHandler();
+  Power_Wake();
+}
 
 /* USER CODE END 1 */
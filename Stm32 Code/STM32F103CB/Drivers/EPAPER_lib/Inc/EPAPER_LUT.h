@@ -1,14 +0,0 @@
-
-
-#ifndef EPAPER_LUT_H_
-#define EPAPER_LUT_H_
-
-#include <stdint.h>
-
-extern const uint8_t EPAPER_lut_vcom[];
-extern const uint8_t EPAPER_lut_ww[];
-extern const uint8_t EPAPER_lut_bw[];
-extern const uint8_t EPAPER_lut_wb[];
-extern const uint8_t EPAPER_lut_bb[];
-
-#endif /* EPAPER_LIB_INC_EPAPER_LUT_H_ */
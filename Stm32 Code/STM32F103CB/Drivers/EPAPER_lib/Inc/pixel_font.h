@@ -1,19 +0,0 @@
-/*
- * pixel_font.h
- *
- *  Created on: Jan 17, 2026
- *      Author: valentin
- */
-
-#ifndef EPAPER_LIB_INC_PIXEL_FONT_H_
-#define EPAPER_LIB_INC_PIXEL_FONT_H_
-
-#include <stdint.h>
-
-
-extern const uint8_t bpixel[];
-extern const uint8_t icone[];
-extern const uint8_t moon[];
-
-
-#endif /* EPAPER_LIB_INC_PIXEL_FONT_H_ */
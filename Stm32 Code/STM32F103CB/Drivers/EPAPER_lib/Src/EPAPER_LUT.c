@@ -1,52 +0,0 @@
-
-
-#include "EPAPER_LUT.h"
-//
-
-/**
- * full screen update LUT
-**/
-const uint8_t EPAPER_lut_vcom[] = {
-	0x01, 0x14, 0x0A, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-};
-
-const uint8_t EPAPER_lut_ww[] = {
-	0x01, 0x14, 0x0A, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-};
-
-const uint8_t EPAPER_lut_bw[] = {
-	0x01, 0x94, 0x0A, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-};
-
-const uint8_t EPAPER_lut_wb[] = {
-	0x01, 0x54, 0x4A, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-};
-
-const uint8_t EPAPER_lut_bb[] = {
-	0x01, 0x54, 0x4A, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
-};
@@ -0,0 +1,332 @@
+#!/usr/bin/env python3
+"""
+asset_compiler.py - compile BDF fonts and PNG images into EPAPER bitmaps
+
+The sources are listed in a manifest (see tools/assets/assets.txt). Each
+image is kept at its native size, rotated into the panel layout used by
+pixel_font.c (image rows run along the panel y axis, image top on the high x
+side, 1 = white) and run length compressed. The output is pixel_assets.c and
+pixel_assets.h, read by the streaming decoder in EPAPER_Asset.c:
+
+    python3 tools/asset_compiler.py tools/assets/assets.txt Drivers/EPAPER_lib
+
+RLE stream, one per bitmap, decoded size = height * width/8 bytes:
+    the bitmap bits, line after line, are cut in runs of the same colour,
+    alternating white / black and starting with white (the first run may be
+    empty). Each run is a list of 4 bit counts, high nibble first: 15 adds 15
+    pixels and keeps the run going, 0-14 adds its value and ends the run.
+
+Only the python standard library is used.
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+RLE_NIBBLE_MORE = 15
+
+
+# ----------------------------------------------------------------------------
+# sources, every loader returns a list of (label, pixels) with pixels[y][x]
+# true for ink (black)
+# ----------------------------------------------------------------------------
+
+def load_bdf(path, chars=None):
+    with open(path) as f:
+        lines = [l.strip() for l in f]
+
+    fbb = None
+    glyphs = {}
+    i = 0
+    while i < len(lines):
+        words = lines[i].split()
+        if not words:
+            i += 1
+            continue
+        if words[0] == "FONTBOUNDINGBOX":
+            fbb = [int(v) for v in words[1:5]]
+        elif words[0] == "STARTCHAR":
+            enc, bbx, bitmap = None, None, []
+            i += 1
+            while not lines[i].startswith("ENDCHAR"):
+                w = lines[i].split()
+                if w[0] == "ENCODING":
+                    enc = int(w[1])
+                elif w[0] == "BBX":
+                    bbx = [int(v) for v in w[1:5]]
+                elif w[0] == "BITMAP":
+                    for k in range(bbx[1]):
+                        i += 1
+                        bitmap.append(int(lines[i], 16))
+                i += 1
+            glyphs[enc] = (bbx, bitmap)
+        i += 1
+
+    if fbb is None:
+        sys.exit("%s: FONTBOUNDINGBOX missing" % path)
+    fw, fh, fx, fy = fbb
+
+    out = []
+    for c in (chars if chars else "".join(chr(e) for e in sorted(glyphs))):
+        if ord(c) not in glyphs:
+            sys.exit("%s: no glyph for %r" % (path, c))
+        (bw, bh, bx, by), bitmap = glyphs[ord(c)]
+        pixels = [[False] * fw for _ in range(fh)]
+        row_bits = (bw + 7) // 8 * 8
+        top = (fh + fy) - (bh + by)
+        for y, value in enumerate(bitmap):
+            for x in range(bw):
+                if value >> (row_bits - 1 - x) & 1:
+                    px, py = x + bx - fx, y + top
+                    if 0 <= px < fw and 0 <= py < fh:
+                        pixels[py][px] = True
+        out.append((c, pixels))
+    return out
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def load_png(path, frames=1):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("%s: not a PNG file" % path)
+
+    pos, idat, palette, trns = 8, b"", None, None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[k:k + 3]) for k in range(0, length, 3)]
+        elif kind == b"tRNS":
+            trns = chunk
+        elif kind == b"IDAT":
+            idat += chunk
+        pos += 12 + length
+
+    if interlace:
+        sys.exit("%s: interlaced PNG not supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    if depth != 8 and ctype not in (0, 3):
+        sys.exit("%s: only 8 bit colour PNG supported" % path)
+
+    raw = zlib.decompress(idat)
+    bpp = max(1, channels * depth // 8)
+    stride = (width * channels * depth + 7) // 8
+    rows, prev, pos = [], bytearray(stride), 0
+    for y in range(height):
+        ftype = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for k in range(stride):
+            a = line[k - bpp] if k >= bpp else 0
+            b = prev[k]
+            c = prev[k - bpp] if k >= bpp else 0
+            line[k] = (line[k] + (0, a, b, (a + b) // 2, paeth(a, b, c))[ftype]) & 0xFF
+        rows.append(line)
+        prev = line
+
+    def sample(line, x):
+        if depth < 8:
+            per_byte = 8 // depth
+            v = line[x // per_byte] >> (8 - depth * (x % per_byte + 1)) & ((1 << depth) - 1)
+            if ctype == 0:
+                return v * 255 // ((1 << depth) - 1), 255
+            r, g, b = palette[v]
+            alpha = trns[v] if trns and v < len(trns) else 255
+            return (r * 3 + g * 6 + b) // 10, alpha
+        px = line[x * channels:(x + 1) * channels]
+        if ctype == 3:
+            r, g, b = palette[px[0]]
+            alpha = trns[px[0]] if trns and px[0] < len(trns) else 255
+            return (r * 3 + g * 6 + b) // 10, alpha
+        if ctype in (0, 4):
+            return px[0], px[1] if ctype == 4 else 255
+        return (px[0] * 3 + px[1] * 6 + px[2]) // 10, px[3] if ctype == 6 else 255
+
+    image = []
+    for line in rows:
+        row = []
+        for x in range(width):
+            grey, alpha = sample(line, x)
+            row.append(alpha >= 128 and grey < 128)
+        image.append(row)
+
+    if width % frames:
+        sys.exit("%s: width %d is not a multiple of %d frames" % (path, width, frames))
+    fw = width // frames
+    return [(str(k), [row[k * fw:(k + 1) * fw] for row in image]) for k in range(frames)]
+
+
+# ----------------------------------------------------------------------------
+# panel layout and compression
+# ----------------------------------------------------------------------------
+
+def to_panel(pixels):
+    """rotate to panel layout, returns (width, height, bytes)"""
+    src_h, src_w = len(pixels), len(pixels[0])
+    byte_width = (src_h + 7) // 8
+    width = byte_width * 8
+    out = bytearray()
+    for cx in range(src_w):
+        line = bytearray(b"\xFF" * byte_width)
+        for cy in range(src_h):
+            if pixels[cy][cx]:
+                p = width - 1 - cy
+                line[p // 8] &= ~(0x80 >> (p % 8)) & 0xFF
+        out += line
+    return width, src_w, bytes(out)
+
+
+def rle(data):
+    """pixel runs, alternating white / black, starting with white"""
+    runs, color, n = [], 1, 0
+    for byte in data:
+        for k in range(8):
+            bit = byte >> (7 - k) & 1
+            if bit == color:
+                n += 1
+            else:
+                runs.append(n)
+                color, n = bit, 1
+    runs.append(n)
+
+    nibbles = []
+    for n in runs:
+        while n >= RLE_NIBBLE_MORE:
+            nibbles.append(RLE_NIBBLE_MORE)
+            n -= RLE_NIBBLE_MORE
+        nibbles.append(n)
+    if len(nibbles) & 1:
+        nibbles.append(0)
+    return bytes(nibbles[k] << 4 | nibbles[k + 1] for k in range(0, len(nibbles), 2))
+
+
+def unrle(data, size):
+    """reference decoder, same walk as EPAPER_RLE_Read"""
+    nibbles = [v for byte in data for v in (byte >> 4, byte & 0x0F)]
+    bits, color, run, k = [], 1, 0, 0
+    while len(bits) < size * 8:
+        n = 0
+        while nibbles[k] == RLE_NIBBLE_MORE:
+            n += RLE_NIBBLE_MORE
+            k += 1
+        n += nibbles[k]
+        k += 1
+        bits += [color] * n
+        color ^= 1
+    bits = bits[:size * 8]
+    return bytes(sum(bits[i + j] << (7 - j) for j in range(8)) for i in range(0, len(bits), 8))
+
+
+# ----------------------------------------------------------------------------
+# output
+# ----------------------------------------------------------------------------
+
+def c_bytes(data, indent="\t", per_line=16):
+    return "\n".join(indent + ", ".join("0x%02X" % b for b in data[k:k + per_line]) + ","
+                     for k in range(0, len(data), per_line))
+
+
+def c_label(label):
+    return "'\\''" if label == "'" else ("'%s'" % label if len(label) == 1 and not label.isdigit() else label)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: asset_compiler.py <manifest> <EPAPER_lib dir>")
+    manifest, lib = sys.argv[1], sys.argv[2]
+    base = os.path.dirname(manifest)
+
+    assets = []
+    with open(manifest) as f:
+        for line in f:
+            line = line.split("#", 1)[0].split()
+            if not line:
+                continue
+            name, kind, source = line[:3]
+            opts = dict(o.split("=", 1) for o in line[3:])
+            path = os.path.join(base, source)
+            if kind == "font":
+                images = load_bdf(path, opts.get("chars"))
+            elif kind == "png":
+                images = load_png(path, int(opts.get("frames", "1")))
+            else:
+                sys.exit("%s: unknown kind %s" % (name, kind))
+            assets.append((name, kind, source, images))
+
+    c = ["/*", " * pixel_assets.c", " *",
+         " *  Generated by tools/asset_compiler.py from tools/assets, do not edit.", " */", "",
+         '#include "pixel_assets.h"', ""]
+    h = ["/*", " * pixel_assets.h", " *",
+         " *  Generated by tools/asset_compiler.py from tools/assets, do not edit.", " */", "",
+         "#ifndef EPAPER_LIB_INC_PIXEL_ASSETS_H_", "#define EPAPER_LIB_INC_PIXEL_ASSETS_H_", "",
+         '#include "EPAPER_Asset.h"', ""]
+
+    total_raw, total_rle = 0, 0
+    for name, kind, source, images in assets:
+        entries = []
+        for k, (label, pixels) in enumerate(images):
+            width, height, raw = to_panel(pixels)
+            packed = rle(raw)
+            assert unrle(packed, len(raw)) == raw
+            total_raw += len(raw)
+            total_rle += len(packed)
+            c.append("// %s %s, %dx%d, %d -> %d bytes" % (source, label, width, height, len(raw), len(packed)))
+            c.append("static const uint8_t %s_data%d[] =" % (name, k))
+            c.append("{")
+            c.append(c_bytes(packed))
+            c.append("};")
+            c.append("")
+            entries.append((label, width, height, "%s_data%d" % (name, k)))
+
+        if kind == "font":
+            chars = [e[0] for e in entries]
+            contiguous = all(ord(chars[k]) == ord(chars[0]) + k for k in range(len(chars)))
+            if not contiguous:
+                sys.exit("%s: font characters must be contiguous" % name)
+            c.append("static const EPAPER_Bitmap %s_glyph[%d] =" % (name, len(entries)))
+            c.append("{")
+            for label, width, height, data in entries:
+                c.append("\t{%d, %d, %s}, // %s" % (width, height, data, c_label(label)))
+            c.append("};")
+            c.append("")
+            first = chars[0]
+            c.append("const EPAPER_Font %s = {'%s', %d, %s_glyph};" % (name, first, len(entries), name))
+            c.append("")
+            h.append("extern const EPAPER_Font %s;" % name)
+        elif len(entries) == 1:
+            label, width, height, data = entries[0]
+            c.append("const EPAPER_Bitmap %s = {%d, %d, %s};" % (name, width, height, data))
+            c.append("")
+            h.append("extern const EPAPER_Bitmap %s;" % name)
+        else:
+            c.append("const EPAPER_Bitmap %s[%d] =" % (name, len(entries)))
+            c.append("{")
+            for label, width, height, data in entries:
+                c.append("\t{%d, %d, %s}," % (width, height, data))
+            c.append("};")
+            c.append("")
+            h.append("extern const EPAPER_Bitmap %s[%d];" % (name, len(entries)))
+
+    h += ["", "#endif /* EPAPER_LIB_INC_PIXEL_ASSETS_H_ */", ""]
+
+    for sub, name, text in (("Src", "pixel_assets.c", c), ("Inc", "pixel_assets.h", h)):
+        path = os.path.join(lib, sub, name)
+        with open(path, "w", newline="\r\n") as f:
+            f.write("\n".join(text))
+    print("%d bitmaps, %d bytes raw, %d bytes compressed" %
+          (sum(len(a[3]) for a in assets), total_raw, total_rle))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+"""
+float_check.py - find floating point code in a firmware link map
+
+Reads the .map file written by the linker (STM32CubeIDE: Debug/<project>.map)
+and lists what pulls soft-float or libm into the image: the __aeabi_d* / __aeabi_f*
+helpers of the ARM run-time ABI, the libgcc double / float routines (__adddf3,
+__muldf3, ...) and any member taken from libm.a. The Cortex-M0 and M3 have no
+FPU, each of these costs flash and thousands of cycles per call.
+
+    python3 tools/float_check.py Debug/STM32F103CB.map
+
+Exits with 1 when something is found, so it can run as a post-build step.
+Only the python standard library is used.
+"""
+
+import re
+import sys
+
+SOFT_FLOAT = re.compile(r"\b(__aeabi_[df]\w+|__aeabi_\w*2[df]|__\w+[ds]f[23]|__\w+[ds]f[ds]i)\b")
+LIBM = re.compile(r"[/\\]libm\.a\((\S+?)\)")
+
+
+def scan(lines):
+    """yield (kind, name, line number) for each floating point item of the map"""
+    seen = set()
+    for number, line in enumerate(lines, 1):
+        for match in SOFT_FLOAT.finditer(line):
+            if ("soft-float", match.group(1)) not in seen:
+                seen.add(("soft-float", match.group(1)))
+                yield "soft-float", match.group(1), number
+        for match in LIBM.finditer(line):
+            if ("libm", match.group(1)) not in seen:
+                seen.add(("libm", match.group(1)))
+                yield "libm", match.group(1), number
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: float_check.py <firmware.map>")
+    with open(sys.argv[1], errors="replace") as f:
+        found = list(scan(f.readlines()))
+
+    for kind, name, number in found:
+        print("%-10s %-24s map line %d" % (kind, name, number))
+    if found:
+        sys.exit("%d floating point item(s) linked" % len(found))
+    print("no soft-float or libm code linked")
+
+
+if __name__ == "__main__":
+    main()
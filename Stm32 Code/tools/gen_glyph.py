@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""
+gen_glyph.py - generate the EPAPER bit expansion tables
+
+The output is a plain C file placed next to pixel_font.c; run the script again
+each time the scale factors change:
+
+    python3 tools/gen_glyph.py Drivers/EPAPER_lib
+
+Tables written:
+    EPAPER_expand_xN   for N = 2..8, 256 entries of N bytes, each input bit
+                       repeated N times (MSB first, same as EPAPER_Dup_Bits)
+
+Large digits and icons are not scaled, they are compiled at their native size
+by asset_compiler.py.
+"""
+
+import os
+import sys
+
+EXPAND_MIN = 2
+EXPAND_MAX = 8
+
+
+def dup_bits(value, mult):
+    bits = 0
+    for b in range(7, -1, -1):
+        bit = (value >> b) & 1
+        for _ in range(mult):
+            bits = (bits << 1) | bit
+    return [(bits >> (8 * (mult - 1 - k))) & 0xFF for k in range(mult)]
+
+
+def c_bytes(data, indent="\t", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join("0x%02X" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    lib = sys.argv[1] if len(sys.argv) > 1 else "."
+
+    out = []
+    out.append("/*")
+    out.append(" * EPAPER_Glyph.c")
+    out.append(" *")
+    out.append(" *  Generated by tools/gen_glyph.py, do not edit.")
+    out.append(" */")
+    out.append("")
+    out.append('#include "EPAPER_Glyph.h"')
+    out.append("")
+
+    for mult in range(EXPAND_MIN, EXPAND_MAX + 1):
+        out.append("static const uint8_t EPAPER_expand_x%d[256 * %d] =" % (mult, mult))
+        out.append("{")
+        data = []
+        for v in range(256):
+            data += dup_bits(v, mult)
+        out.append(c_bytes(data, per_line=max(mult * (16 // mult), mult)))
+        out.append("};")
+        out.append("")
+
+    out.append("const uint8_t * const EPAPER_expand[EPAPER_EXPAND_MAX + 1] =")
+    out.append("{")
+    out.append("\t0, 0,")
+    for mult in range(EXPAND_MIN, EXPAND_MAX + 1):
+        out.append("\tEPAPER_expand_x%d," % mult)
+    out.append("};")
+    out.append("")
+
+    path = os.path.join(lib, "Src", "EPAPER_Glyph.c")
+    with open(path, "w", newline="\r\n") as f:
+        f.write("\n".join(out))
+    print("wrote", path)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""
+probe_report.py - report of the cycle probes
+
+Reads the text written by Probe_Dump (a serial log of the board, other lines
+are skipped) and prints, for each probe, the call count, min / mean / max in
+cycles and microseconds and the histogram of the call durations:
+
+    python3 tools/probe_report.py uart.log
+    python3 tools/probe_report.py -a uart.log      report every dump, not only the last
+
+The firmware keeps summing between dumps until 'r' clears the probes, so the
+last dump of a log covers the whole run. Only the python standard library is
+used.
+"""
+
+import sys
+
+BUCKET_BASE = 4     # bucket b counts calls of BUCKET_BASE^b to BUCKET_BASE^(b+1) - 1 cycles
+BAR = 40
+
+
+def read_dumps(lines):
+    """yield (clock Hz, [(name, count, min, max, mean, histogram)]) per dump"""
+    clock = None
+    probes = []
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == "PROBE" and len(words) == 3:
+            clock = int(words[2])
+            probes = []
+        elif words[0] == "PROBE_END" and clock is not None:
+            yield clock, probes
+            clock = None
+        elif words[0] == "P" and clock is not None and len(words) > 6:
+            values = [int(w) for w in words[2:]]
+            probes.append((words[1], values[0], values[1], values[2], values[3], values[4:]))
+
+
+def duration(cycles, clock):
+    us = cycles * 1e6 / clock
+    if us >= 1e6:
+        return "%.2f s" % (us / 1e6)
+    if us >= 1e3:
+        return "%.2f ms" % (us / 1e3)
+    return "%.1f us" % us
+
+
+def report(clock, probes):
+    print("core clock %d Hz" % clock)
+    print("%-16s %8s %12s %12s %12s %12s" % ("probe", "calls", "min", "mean", "max", "total"))
+    for name, count, low, high, mean, _ in probes:
+        if count == 0:
+            print("%-16s %8d %12s %12s %12s %12s" % (name, 0, "-", "-", "-", "-"))
+            continue
+        print("%-16s %8d %12s %12s %12s %12s" % (name, count, duration(low, clock), duration(mean, clock),
+                                                 duration(high, clock), duration(mean * count, clock)))
+    print()
+
+    for name, count, _, _, _, histogram in probes:
+        if count == 0:
+            continue
+        print("%s (cycles)" % name)
+        top = max(histogram)
+        used = [b for b, n in enumerate(histogram) if n]
+        for b in range(used[0], used[-1] + 1):
+            low = BUCKET_BASE ** b if b else 0
+            high = BUCKET_BASE ** (b + 1) - 1
+            if b == len(histogram) - 1:
+                label = ">= %d" % low
+            else:
+                label = "%d-%d" % (low, high)
+            n = histogram[b]
+            print("  %-24s %6d %s" % (label, n, "#" * ((n * BAR + top - 1) // top)))
+        print()
+
+
+def main():
+    args = sys.argv[1:]
+    every = "-a" in args
+    files = [a for a in args if a != "-a"] or ["-"]
+
+    lines = []
+    for path in files:
+        f = sys.stdin if path == "-" else open(path, errors="replace")
+        lines += f.readlines()
+
+    dumps = list(read_dumps(lines))
+    if not dumps:
+        sys.exit("no PROBE dump found")
+    for clock, probes in (dumps if every else dumps[-1:]):
+        report(clock, probes)
+
+
+if __name__ == "__main__":
+    main()
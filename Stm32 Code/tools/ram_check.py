@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""
+ram_check.py - RAM budget of a firmware link map
+
+Reads the .map file written by the linker (STM32CubeIDE: Debug/<project>.map)
+and prints how the RAM region is used: .data, .bss and the heap / stack
+reserve of ._user_heap_stack, what is left, and the largest variables. The
+F072 has 16 KB of RAM and the frame buffer alone takes 10.5 KB of it.
+
+    python3 tools/ram_check.py Debug/NUCLEO_STM32F072RB.map
+    python3 tools/ram_check.py Debug/NUCLEO_STM32F072RB.map 512
+
+The optional second argument is the margin in bytes to keep free. Exits with
+1 when the RAM sections do not fit with that margin, so it can run as a
+post-build step. Only the python standard library is used.
+"""
+
+import re
+import sys
+
+REGION = re.compile(r"^(\w+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+OUTPUT = re.compile(r"^(\.data|\.bss|\._user_heap_stack)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)|\s*$)")
+INPUT = re.compile(r"^ (\.data\S*|\.bss\S*|COMMON)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+))?")
+PLACED = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+)")
+SYMBOL = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+(\w+)$")
+TOP = 12
+
+
+def parse(lines):
+    """return the RAM region (origin, length), the output sections and the variables"""
+    ram = None
+    sections = {}
+    variables = []
+    pending = None
+    output = None
+    for line in lines:
+        line = line.rstrip("\n")
+        match = REGION.match(line)
+        if match and match.group(1) == "RAM" and ram is None:
+            ram = (int(match.group(2), 16), int(match.group(3), 16))
+            continue
+        match = OUTPUT.match(line)
+        if match:
+            pending = None
+            if match.group(2):
+                sections[match.group(1)] = (int(match.group(2), 16), int(match.group(3), 16))
+            else:
+                output = match.group(1)   # long name, address on the next line
+            continue
+        match = INPUT.match(line)
+        if match:
+            pending = None
+            if match.group(2):
+                size = int(match.group(3), 16)
+                if size:
+                    variables.append([size, match.group(1), match.group(4)])
+            else:
+                pending = match.group(1)
+            continue
+        match = PLACED.match(line)
+        if match and output:
+            sections[output] = (int(match.group(1), 16), int(match.group(2), 16))
+            output = None
+            continue
+        if match and pending:
+            size = int(match.group(2), 16)
+            if size:
+                variables.append([size, pending, match.group(3)])
+            pending = None
+            continue
+        match = SYMBOL.match(line)
+        if match and variables and variables[-1][1] in (".bss", ".data", "COMMON"):
+            variables[-1][1] += " " + match.group(2)
+    return ram, sections, variables
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        sys.exit("usage: ram_check.py <firmware.map> [margin bytes]")
+    margin = int(sys.argv[2]) if len(sys.argv) == 3 else 0
+    with open(sys.argv[1], errors="replace") as f:
+        ram, sections, variables = parse(f.readlines())
+
+    if ram is None or ".bss" not in sections:
+        sys.exit("no RAM region or .bss section in the map")
+    origin, length = ram
+    end = max(start + size for start, size in sections.values())
+    used = end - origin
+
+    for name in (".data", ".bss", "._user_heap_stack"):
+        if name in sections:
+            print("%-18s %6d bytes" % (name, sections[name][1]))
+    print("%-18s %6d of %d bytes, %d free" % ("RAM", used, length, length - used))
+    print()
+    for size, name, where in sorted(variables, reverse=True)[:TOP]:
+        print("%6d  %-32s %s" % (size, name.replace(".bss.", "").replace(".data.", ""), where))
+
+    if used + margin > length:
+        sys.exit("RAM over by %d bytes (margin %d)" % (used + margin - length, margin))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,53 @@
+/*
+ * date_test.c
+ *
+ *  Host check of the epoch calendar of Drivers/DATE against the C library:
+ *  every day from 1970 to 2100 (at a different second of the day each),
+ *  fields, day of the week and round trip.
+ *
+ *  make test (or make date_test && ./date_test), exits with 1 on a mismatch
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "date_converter.h"
+
+int main(void)
+{
+	uint32_t last = Date_Days(2101, 0, 1);
+	long bad = 0;
+
+	if (Date_Days(1970, 0, 1) != 0 || last != 47847)
+	{
+		printf("day count of 1970 / 2101 wrong: %u %u\n", Date_Days(1970, 0, 1), last);
+		return 1;
+	}
+
+	for (uint32_t days = 0; days < last; days++)
+	{
+		uint32_t epoch = days * 86400 + (days * 7919) % 86400;
+		time_t t = epoch;
+		struct tm ref;
+		Date_Time date;
+
+		gmtime_r(&t, &ref);
+		Date_From_Epoch(epoch, &date);
+
+		if (date.yy != ref.tm_year + 1900 || date.mm != ref.tm_mon || date.dd != ref.tm_mday
+				|| date.day != (ref.tm_wday + 6) % 7
+				|| date.minute != ref.tm_hour * 60 + ref.tm_min || date.second != ref.tm_sec
+				|| Date_Weekday(days) != date.day
+				|| Date_Days(date.yy, date.mm, date.dd) != days
+				|| Date_To_Epoch(&date) != epoch)
+		{
+			if (bad < 10)
+				printf("%u: got %04u-%02u-%02u day %u %02u:%02u:%02u, want %04d-%02d-%02d day %d %02d:%02d:%02d\n",
+						epoch, date.yy, date.mm + 1, date.dd, date.day, date.minute / 60, date.minute % 60, date.second,
+						ref.tm_year + 1900, ref.tm_mon + 1, ref.tm_mday, (ref.tm_wday + 6) % 7, ref.tm_hour, ref.tm_min, ref.tm_sec);
+			bad++;
+		}
+	}
+
+	printf("date: %u days from 1970 to 2100, %ld mismatch\n", last, bad);
+	return bad != 0;
+}
@@ -0,0 +1,30 @@
+/*
+ * main.h
+ *
+ *  Host stand-in for the CubeMX main.h, only what DRIVER.h and scratch.c use
+ */
+
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#include <stdint.h>
+
+#define RST_Pin 0
+#define RST_GPIO_Port 0
+#define DC_Pin 0
+#define DC_GPIO_Port 0
+#define SPI_CS_Pin 0
+#define SPI_CS_GPIO_Port 0
+#define BUSY_Pin 0
+#define BUSY_GPIO_Port 0
+#define DIN_Pin 0
+#define DIN_GPIO_Port 0
+#define SCK_Pin 0
+#define SCK_GPIO_Port 0
+
+static inline uintptr_t __get_MSP(void) { return 0; }
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t primask) { (void)primask; }
+static inline void __disable_irq(void) { }
+
+#endif /* __MAIN_H */
@@ -0,0 +1,16 @@
+/*
+ * port_host.h
+ *
+ *  Host port of the shared drivers (port.h with PORT_HOST). The simulator
+ *  replaces DRIVER.c with sim_driver.c, so no pin or SPI access is needed,
+ *  only the tick, on the virtual clock of sim_panel.c.
+ */
+
+#ifndef PORT_HOST_H_
+#define PORT_HOST_H_
+
+#include <stdint.h>
+
+uint32_t HAL_GetTick(void);
+
+#endif /* PORT_HOST_H_ */
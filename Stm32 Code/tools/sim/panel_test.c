@@ -0,0 +1,131 @@
+/*
+ * panel_test.c
+ *
+ *  Host check of the waveforms against the controller model: the colour a
+ *  register waveform leaves on pixels that keep their colour, then full
+ *  waveform refreshes of white regions (white redrawn on white, and cleans)
+ *  run through EPAPER_lib like the firmware does.
+ *
+ *  make test (or make panel_test && ./panel_test), exits with 1 on a mismatch.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "EPAPER.h"
+#include "sim_panel.h"
+
+#define BOX_X 100   // black box drawn in screen coordinates
+#define BOX_Y 60
+#define BOX_W 80
+#define BOX_H 40
+
+static int bad = 0;
+
+/* ww waveform alone on a white panel (both planes white), nothing else set */
+static void Raw_Refresh_ww(const uint8_t *phases, uint8_t count)
+{
+	uint8_t lut[EPAPER_LUT_SIZE] = {0};
+
+	lut[0] = 0x01;
+	memcpy(&lut[1], phases, count);
+	Sim_Panel_Command(0x00);
+	Sim_Panel_Data(0x3F);           // KW mode, LUT from registers
+	Sim_Panel_Command(0x21);
+	for (uint8_t i = 0; i < EPAPER_LUT_SIZE; i++)
+		Sim_Panel_Data(lut[i]);
+	Sim_Panel_Command(0x10);
+	for (uint32_t i = 0; i < (uint32_t)EPAPER_BYTE_WIDTH * EPAPER_HEIGHT; i++)
+		Sim_Panel_Data(0xFF);
+	Sim_Panel_Command(0x13);
+	for (uint32_t i = 0; i < (uint32_t)EPAPER_BYTE_WIDTH * EPAPER_HEIGHT; i++)
+		Sim_Panel_Data(0xFF);
+	Sim_Panel_Command(0x12);
+}
+
+/* every pixel of the screen against the expected image, box black or not */
+static void Check_Screen(const char *name, uint8_t box)
+{
+	long wrong = 0;
+
+	for (uint16_t y = 0; y < EPAPER_SCREEN_HEIGHT; y++)
+	{
+		for (uint16_t x = 0; x < EPAPER_SCREEN_WIDTH; x++)
+		{
+			uint8_t in = box && x >= BOX_X && x < BOX_X + BOX_W && y >= BOX_Y && y < BOX_Y + BOX_H;
+			if (Sim_Pixel(x, y) != (in ? SIM_BLACK : SIM_WHITE))
+				wrong++;
+		}
+	}
+	printf("%-36s %6ld wrong pixels\n", name, wrong);
+	if (wrong)
+		bad++;
+}
+
+static void Check_All(const char *name, Sim_Color want)
+{
+	long wrong = 0;
+
+	for (uint16_t y = 0; y < EPAPER_SCREEN_HEIGHT; y++)
+	{
+		for (uint16_t x = 0; x < EPAPER_SCREEN_WIDTH; x++)
+			wrong += Sim_Pixel(x, y) != want;
+	}
+	printf("%-36s %6ld wrong pixels\n", name, wrong);
+	if (wrong)
+		bad++;
+}
+
+int main(void)
+{
+	/* the last driving phase of ww sets the colour of white pixels */
+	static const uint8_t to_black[] = {0x68};
+	static const uint8_t undriven[] = {0x14, 0x0A};
+	static const uint8_t to_white[] = {0x68, 0x94};
+
+	Sim_Panel_Init(NULL, 0);
+	Raw_Refresh_ww(to_black, sizeof(to_black));
+	Check_All("ww ending on black", SIM_BLACK);
+	Raw_Refresh_ww(undriven, sizeof(undriven));
+	Check_All("ww undriven keeps the panel", SIM_BLACK);
+	Raw_Refresh_ww(to_white, sizeof(to_white));
+	Check_All("ww ending on white", SIM_WHITE);
+
+	/* same start as the firmware, then a box and a full-mode clean around it */
+	Sim_Panel_Init(NULL, 0);
+	EPAPER_Set_Temperature(231);
+	EPAPER_Init();
+	EPAPER_Clear();
+	EPAPER_Part_Init();
+	EPAPER_KW_White_Display();
+	Check_Screen("white screen", 0);
+
+	EPAPER_Draw_Rect(BOX_X, BOX_Y, BOX_W, BOX_H, 0x00);
+	EPAPER_Flush();
+	while (EPAPER_Refresh_Poll())
+		;
+	Check_Screen("partial refresh of the box", 1);
+
+	/* white drawn on white: old and new planes white, the ww waveform */
+	EPAPER_Refresh_Mode(EPAPER_LUT_FULL);
+	EPAPER_Draw_Rect(BOX_X + BOX_W, 0, EPAPER_SCREEN_WIDTH - BOX_X - BOX_W, EPAPER_SCREEN_HEIGHT, 0xFF);
+	EPAPER_Flush();
+	while (EPAPER_Refresh_Poll())
+		;
+	Check_Screen("full refresh of a white region", 1);
+
+	EPAPER_Rect half = {0, 0, EPAPER_WIDTH - 1, EPAPER_HEIGHT / 2 - 1};
+	EPAPER_Clean_Region(&half);
+	EPAPER_Flush();
+	while (EPAPER_Refresh_Poll())
+		;
+	Check_Screen("full clean of half the panel", 1);
+
+	EPAPER_Rect all = {0, 0, EPAPER_WIDTH - 1, EPAPER_HEIGHT - 1};
+	EPAPER_Clean_Region(&all);
+	EPAPER_Flush();
+	while (EPAPER_Refresh_Poll())
+		;
+	Check_Screen("full clean of the whole panel", 1);
+
+	return bad != 0;
+}
@@ -0,0 +1,176 @@
+/*
+ * sim_driver.c
+ *
+ *  DRIVER.h on the host: every byte goes to the controller model of
+ *  sim_panel.c, BUSY follows its virtual clock.
+ */
+
+#include "DRIVER.h"
+#include "EPAPER_Trace.h"
+#include "sim_panel.h"
+
+#define SIM_POLL_US 1000    // virtual time spent by one EPAPER_Busy() poll
+
+/* linker symbols used by scratch.c */
+uint8_t _end, _estack, _Min_Heap_Size;
+
+static EPAPER_Transfer_Callback busy_done = NULL;
+static uint8_t busy_active = 0;
+static uint64_t busy_start = 0;
+static uint32_t busy_time = 0;
+static uint32_t busy_total = 0;
+
+uint32_t HAL_GetTick(void)
+{
+	return (uint32_t)(Sim_Now_us() / 1000);
+}
+
+void SPI_WriteByte(uint8_t value)
+{
+	Sim_Panel_Data(value);
+}
+
+void SPI_Write_nByte(uint8_t *value, uint32_t len)
+{
+	while (len--)
+		Sim_Panel_Data(*value++);
+}
+
+void EPAPER_GPIO_Init(void)
+{
+}
+
+void EPAPER_GPIO_Exit(void)
+{
+}
+
+void EPAPER_Reset(void)
+{
+	Sim_Panel_Reset();
+}
+
+void EPAPER_SendCommand(uint8_t Reg)
+{
+	EPAPER_TRACE_COMMAND(Reg);
+	Sim_Panel_Command(Reg);
+}
+
+void EPAPER_SendData(uint8_t Data)
+{
+	Sim_Panel_Data(Data);
+	EPAPER_TRACE_DATA(&Data, 1);
+}
+
+void EPAPER_Send_nData(const uint8_t *pData, uint32_t Len)
+{
+	for (uint32_t i = 0; i < Len; i++)
+		Sim_Panel_Data(pData[i]);
+	EPAPER_TRACE_DATA(pData, Len);
+}
+
+void EPAPER_Send_Fill(uint8_t Data, uint32_t Len)
+{
+	for (uint32_t i = 0; i < Len; i++)
+		Sim_Panel_Data(Data);
+	EPAPER_TRACE_DATA(NULL, Len);
+}
+
+void EPAPER_Transfer_Init(void)
+{
+}
+
+int EPAPER_Send_nData_DMA(const uint8_t *pData, uint32_t Len, EPAPER_Transfer_Callback done)
+{
+	EPAPER_Send_nData(pData, Len);
+	if (done)
+		done();
+	return 0;
+}
+
+int EPAPER_Send_Fill_DMA(uint8_t Data, uint32_t Len, EPAPER_Transfer_Callback done)
+{
+	EPAPER_Send_Fill(Data, Len);
+	if (done)
+		done();
+	return 0;
+}
+
+uint8_t EPAPER_Transfer_Busy(void)
+{
+	return 0;
+}
+
+int EPAPER_Transfer_Wait(void)
+{
+	return 0;
+}
+
+void EPAPER_Transfer_IRQHandler(void)
+{
+}
+
+void EPAPER_Busy_Init(void)
+{
+}
+
+/**
+ * @brief End of busy, what the EXTI interrupt does on the target
+ */
+static void EPAPER_Busy_End(void)
+{
+	EPAPER_Transfer_Callback done = busy_done;
+
+	busy_time = (uint32_t)((Sim_Now_us() - busy_start) / 1000);
+	busy_total += busy_time;
+	busy_active = 0;
+	busy_done = NULL;
+	EPAPER_TRACE_BUSY(busy_time);
+	if (done)
+		done();
+}
+
+void EPAPER_Busy_Start(EPAPER_Transfer_Callback done)
+{
+	busy_done = done;
+	busy_start = Sim_Now_us();
+	busy_active = 1;
+}
+
+/**
+ * @brief Each poll moves the virtual clock, like the main loop would
+ */
+uint8_t EPAPER_Busy(void)
+{
+	if (busy_active)
+	{
+		if (Sim_Now_us() >= Sim_Busy_Until_us())
+			EPAPER_Busy_End();
+		else
+			Sim_Advance_us(SIM_POLL_US);
+	}
+	return busy_active;
+}
+
+void EPAPER_ReadBusy(void)
+{
+	if (!busy_active)
+		EPAPER_Busy_Start(NULL);
+
+	if (Sim_Now_us() < Sim_Busy_Until_us())
+		Sim_Advance_us(Sim_Busy_Until_us() - Sim_Now_us());
+	EPAPER_Busy_End();
+}
+
+uint32_t EPAPER_Busy_Time(void)
+{
+	return busy_time;
+}
+
+uint32_t EPAPER_Busy_Total(void)
+{
+	return busy_total;
+}
+
+void EPAPER_Busy_IRQHandler(void)
+{
+}
@@ -0,0 +1,171 @@
+/*
+ * sim_main.c
+ *
+ *  Host simulator of the clock display: runs the EPAPER_lib code of the
+ *  firmware against the controller model and reports what the panel got.
+ *
+ *  sim [-o dir] [-r trace] [-n minutes] [-s start_minute] [-t temp] [-v]
+ *    -o dir      write a PBM (PPM with red) of the panel after each refresh
+ *    -r trace    write the EPAPER_Trace dump of each update, for trace_decode.py
+ *    -n minutes  minutes to run after the first screen, default 60
+ *    -s minute   minute of the day to start at, default 754 (12h34)
+ *    -t temp     starting temperature in 0.1 °C, default 231
+ *    -v          one line per refresh
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "EPAPER.h"
+#include "EPAPER_Ghost.h"
+#include "EPAPER_Trace.h"
+#include "EPAPER_Widget.h"
+#include "sim_panel.h"
+
+#define SIM_MINUTE_US 60000000ULL
+
+static int temp_alert = 0;
+static FILE *trace_file = NULL;
+
+static void Draw_Alerts(void)
+{
+	if (temp_alert)
+		EPAPER_Draw_Rect(218, 90, 132, 4, 0x00);
+}
+
+static void Trace_Write(const char *text, uint16_t len)
+{
+	fwrite(text, 1, len, trace_file);
+}
+
+/* same as the firmware would do over a UART after each update */
+static void Trace_Flush(void)
+{
+#if EPAPER_TRACE
+	if (trace_file == NULL)
+		return;
+	EPAPER_Trace_Dump(Trace_Write);
+	EPAPER_Trace_Reset();
+#endif
+}
+
+int main(int argc, char **argv)
+{
+	const char *dump_dir = NULL;
+	const char *trace_path = NULL;
+	int minutes = 60;
+	int start = 754;
+	int temp = 231;
+	int verbose = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "o:r:n:s:t:v")) != -1)
+	{
+		switch (opt)
+		{
+			case 'o': dump_dir = optarg; break;
+			case 'r': trace_path = optarg; break;
+			case 'n': minutes = atoi(optarg); break;
+			case 's': start = atoi(optarg) % 1440; break;
+			case 't': temp = atoi(optarg); break;
+			case 'v': verbose = 1; break;
+			default:
+				fprintf(stderr, "usage: %s [-o dir] [-r trace] [-n minutes] [-s start_minute] [-t temp] [-v]\n", argv[0]);
+				return 1;
+		}
+	}
+
+	if (trace_path != NULL && (trace_file = fopen(trace_path, "w")) == NULL)
+	{
+		perror(trace_path);
+		return 1;
+	}
+	Sim_Panel_Init(dump_dir, verbose);
+
+	/* same sequence as main.c */
+	uint16_t minute = start;
+	uint8_t moon_phase = 4;
+	uint32_t press = 1013;
+	uint32_t hum = 45;
+
+	EPAPER_Set_Temperature(temp);
+	EPAPER_Init();
+	EPAPER_Clear();
+	EPAPER_Part_Init();
+	EPAPER_KW_White_Display();
+
+	EPAPER_Widget_Register(&EPAPER_widget_date);
+	EPAPER_Widget_Register(&EPAPER_widget_hour);
+	EPAPER_Widget_Register(&EPAPER_widget_sky);
+	EPAPER_Widget_Register(&EPAPER_widget_temp);
+	EPAPER_Widget_Register(&EPAPER_widget_press);
+	EPAPER_Widget_Register(&EPAPER_widget_hum);
+	EPAPER_Widget_Set(&EPAPER_widget_date, 0, 2);
+	EPAPER_Widget_Set(&EPAPER_widget_date, 1, 17);
+	EPAPER_Widget_Set(&EPAPER_widget_date, 2, 10);
+	EPAPER_Widget_Set(&EPAPER_widget_press, 0, press);
+	EPAPER_Widget_Set(&EPAPER_widget_hum, 0, hum);
+	EPAPER_Widget_Set(&EPAPER_widget_sky, 0, moon_phase);
+	EPAPER_Widget_Set(&EPAPER_widget_sky, 1, minute);
+	EPAPER_Widget_Set(&EPAPER_widget_hour, 0, minute);
+	EPAPER_Widget_Set(&EPAPER_widget_temp, 0, temp);
+	EPAPER_Widget_Update(NULL);
+	while (EPAPER_Refresh_Poll())
+		;
+	Trace_Flush();
+
+	uint64_t t0 = Sim_Now_us();
+	for (int i = 1; i <= minutes; i++)
+	{
+		/* wait for the next minute tick */
+		if (Sim_Now_us() < t0 + i * SIM_MINUTE_US)
+			Sim_Advance_us(t0 + i * SIM_MINUTE_US - Sim_Now_us());
+		minute = (minute + 1) % 1440;
+
+		EPAPER_Widget_Set(&EPAPER_widget_hour, 0, minute);
+		EPAPER_Widget_Set(&EPAPER_widget_sky, 1, minute);
+
+		/* slow temperature drift, crosses the alert limit on long runs */
+		if (i % 7 == 0)
+			temp += (i / 240) % 2 ? -3 : 3;
+		EPAPER_Set_Temperature(temp);
+		EPAPER_Widget_Set(&EPAPER_widget_temp, 0, temp);
+
+		if (temp_alert != (temp < 0 || temp >= 300))
+		{
+			temp_alert = !temp_alert;
+			EPAPER_Red_Layer(temp_alert ? Draw_Alerts : NULL);
+		}
+
+		EPAPER_Ghost_Tick();
+		uint8_t fast = EPAPER_Ghost_Service(minute) == EPAPER_GHOST_NONE;
+
+		EPAPER_Widget_Draw();
+		if (!EPAPER_Red_Flush() && fast)
+			EPAPER_Refresh_Mode(EPAPER_LUT_FAST);
+		EPAPER_Widget_Update(NULL);
+		while (EPAPER_Refresh_Poll())
+			;
+		Trace_Flush();
+	}
+
+	const Sim_Stats *s = Sim_Get_Stats();
+	const EPAPER_Ghost_Stats *g = EPAPER_Ghost_Get_Stats();
+	printf("simulated %d minutes from %02d:%02d\n", minutes, start / 60, start % 60);
+	printf("  commands      %10u\n", s->commands);
+	printf("  data bytes    %10u  (%u LUT)\n", s->data_bytes, s->lut_bytes);
+	printf("  CS pulses     %10u\n", s->commands + s->data_bytes);
+	printf("  SPI time      %10.1f ms\n", s->spi_us / 1000.0);
+	printf("  refreshes     %10u  %.1f s busy, %u pixels driven\n", s->refreshes, s->refresh_ms / 1000.0, s->driven);
+	printf("  cleanings     %10u regional, %u full\n", g->regional, g->full);
+
+	if (dump_dir)
+	{
+		char path[400];
+		snprintf(path, sizeof(path), "%s/last", dump_dir);
+		Sim_Dump(path);
+	}
+	if (trace_file != NULL)
+		fclose(trace_file);
+	return 0;
+}
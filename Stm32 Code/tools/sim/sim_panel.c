@@ -0,0 +1,352 @@
+/*
+ * sim_panel.c
+ *
+ *  e-Paper controller model for the host simulator
+ */
+
+#include "sim_panel.h"
+#include <string.h>
+
+#define SIM_LUT_FIRST 0x20
+#define SIM_LUT_COUNT 5
+#define SIM_LEVEL_NONE 0        // LUT drive levels, bits 7-6 of a phase byte
+#define SIM_LEVEL_BLACK 1
+#define SIM_LEVEL_WHITE 2
+
+typedef struct
+{
+	/* controller RAM and registers */
+	uint8_t old_plane[EPAPER_HEIGHT][EPAPER_BYTE_WIDTH];   // 0x10
+	uint8_t new_plane[EPAPER_HEIGHT][EPAPER_BYTE_WIDTH];   // 0x13
+	uint8_t psr;                                            // panel setting, first byte
+	uint8_t lut[SIM_LUT_COUNT][EPAPER_LUT_SIZE];            // 0x20 .. 0x24 ww bw wb bb
+	uint8_t window[7];
+	uint8_t partial;
+
+	/* command decoding */
+	uint8_t cmd;
+	uint16_t arg;
+	uint16_t x, y;          // data cursor, x in bytes
+
+	/* virtual panel */
+	uint8_t shown[EPAPER_HEIGHT][EPAPER_WIDTH];
+
+	uint64_t now_us;
+	uint64_t busy_until_us;
+	Sim_Stats total;
+	Sim_Stats last;         // since the last refresh
+	const char *dump_dir;
+	uint8_t verbose;
+} Sim_Panel;
+
+static Sim_Panel sim;
+
+/**
+ * @brief Start with a white panel and cleared RAM
+ * @param dump_dir Folder for a picture after each refresh, NULL for none
+ * @param verbose Print a line per refresh
+ */
+void Sim_Panel_Init(const char *dump_dir, uint8_t verbose)
+{
+	memset(&sim, 0, sizeof(sim));
+	sim.dump_dir = dump_dir;
+	sim.verbose = verbose;
+	Sim_Panel_Reset();
+}
+
+/**
+ * @brief Hardware reset: registers back to their default, RAM is kept
+ */
+void Sim_Panel_Reset(void)
+{
+	sim.psr = 0x0F;
+	sim.partial = 0;
+	sim.cmd = 0;
+	memset(sim.lut, 0, sizeof(sim.lut));
+	Sim_Advance_us((uint64_t)SIM_RESET_MS * 1000);
+}
+
+static uint16_t Sim_Window_X0(void) { return sim.partial ? (sim.window[0] >> 3) : 0; }
+static uint16_t Sim_Window_X1(void) { return sim.partial ? (sim.window[1] >> 3) : EPAPER_BYTE_WIDTH - 1; }
+static uint16_t Sim_Window_Y0(void) { return sim.partial ? (sim.window[2] << 8 | sim.window[3]) : 0; }
+static uint16_t Sim_Window_Y1(void) { return sim.partial ? (sim.window[4] << 8 | sim.window[5]) : EPAPER_HEIGHT - 1; }
+
+/**
+ * @brief Refresh time of the register waveform: frames of the vcom groups
+ */
+static uint32_t Sim_Lut_ms(void)
+{
+	uint32_t frames = 0;
+
+	for (uint8_t i = 0; i < EPAPER_LUT_SIZE; i += 7)
+	{
+		const uint8_t *group = &sim.lut[0][i];
+		uint32_t sum = 0;
+		for (uint8_t p = 1; p <= 4; p++)
+			sum += group[p] & 0x3F;
+		frames += sum * (group[5] ? group[5] : 1);
+	}
+	return frames * SIM_FRAME_MS;
+}
+
+/**
+ * @brief Drive level of the last phase of a register waveform that moves
+ *        the particles: bits 7-6 of the phase byte, 01 black, 10 white
+ * @retval SIM_LEVEL_BLACK, SIM_LEVEL_WHITE, SIM_LEVEL_NONE if nothing drives
+ */
+static uint8_t Sim_Lut_Level(const uint8_t *lut)
+{
+	uint8_t level = SIM_LEVEL_NONE;
+
+	for (uint8_t i = 0; i < EPAPER_LUT_SIZE; i += 7)
+	{
+		for (uint8_t p = 1; p <= 4; p++)
+		{
+			uint8_t l = lut[i + p] >> 6;
+			if ((l == SIM_LEVEL_BLACK || l == SIM_LEVEL_WHITE) && (lut[i + p] & 0x3F))
+				level = l;
+		}
+	}
+	return level;
+}
+
+/**
+ * @brief Write the current panel as PBM, or PPM once red shows up
+ * @param path File name without extension
+ * @retval 0, -1 if the file cannot be written
+ */
+int Sim_Dump(const char *path)
+{
+	uint8_t red = 0;
+	char name[512];
+	FILE *f;
+
+	for (uint16_t y = 0; y < EPAPER_HEIGHT && !red; y++)
+		red = memchr(sim.shown[y], SIM_RED, EPAPER_WIDTH) != NULL;
+
+	snprintf(name, sizeof(name), "%s.%s", path, red ? "ppm" : "pbm");
+	f = fopen(name, "wb");
+	if (f == NULL)
+		return -1;
+
+	fprintf(f, "%s\n%d %d\n%s", red ? "P6" : "P1", EPAPER_SCREEN_WIDTH, EPAPER_SCREEN_HEIGHT, red ? "255\n" : "");
+	for (uint16_t y = 0; y < EPAPER_SCREEN_HEIGHT; y++)
+	{
+		for (uint16_t x = 0; x < EPAPER_SCREEN_WIDTH; x++)
+		{
+			Sim_Color c = Sim_Pixel(x, y);
+			if (red)
+			{
+				uint8_t rgb[3] = {255, 255, 255};
+				if (c == SIM_BLACK) rgb[0] = rgb[1] = rgb[2] = 0;
+				if (c == SIM_RED) rgb[1] = rgb[2] = 0;
+				fwrite(rgb, 1, 3, f);
+			}
+			else
+			{
+				fputc(c == SIM_BLACK ? '1' : '0', f);
+			}
+		}
+		if (!red)
+			fputc('\n', f);
+	}
+	fclose(f);
+	return 0;
+}
+
+/**
+ * @brief Run the refresh started by 0x17 / 0x12
+ */
+static void Sim_Refresh(void)
+{
+	uint8_t kwr = !(sim.psr & 0x10);
+	uint8_t reg = (sim.psr & 0x20) && !kwr;
+	uint16_t x0 = kwr ? 0 : Sim_Window_X0(), x1 = kwr ? EPAPER_BYTE_WIDTH - 1 : Sim_Window_X1();
+	uint16_t y0 = kwr ? 0 : Sim_Window_Y0(), y1 = kwr ? EPAPER_HEIGHT - 1 : Sim_Window_Y1();
+	uint8_t level[4] = {SIM_LEVEL_WHITE, SIM_LEVEL_WHITE, SIM_LEVEL_BLACK, SIM_LEVEL_BLACK}; // OTP: to the new data
+	uint32_t driven = 0;
+	uint32_t ms;
+
+	if (reg)
+	{
+		for (uint8_t i = 0; i < 4; i++)
+			level[i] = Sim_Lut_Level(sim.lut[1 + i]);
+		ms = Sim_Lut_ms();
+	}
+	else
+	{
+		ms = kwr ? SIM_OTP_KWR_MS : SIM_OTP_KW_MS;
+	}
+
+	for (uint16_t y = y0; y <= y1 && y < EPAPER_HEIGHT; y++)
+	{
+		for (uint16_t x = x0 * 8; x <= x1 * 8 + 7 && x < EPAPER_WIDTH; x++)
+		{
+			uint8_t bit = 0x80 >> (x & 7);
+			uint8_t o = (sim.old_plane[y][x >> 3] & bit) != 0;    // 1 = white
+			uint8_t n = (sim.new_plane[y][x >> 3] & bit) != 0;
+
+			if (kwr)
+			{
+				/* old plane is black / white, new plane is red */
+				uint8_t r = ((sim.new_plane[y][x >> 3] ^ EPAPER_RED_POLARITY ^ 0xFF) & bit) != 0;
+				sim.shown[y][x] = r ? SIM_RED : (o ? SIM_WHITE : SIM_BLACK);
+				driven++;
+				continue;
+			}
+
+			/* ww bw wb bb, the last driving phase of the waveform sets the colour */
+			uint8_t l = level[o ? (n ? 0 : 2) : (n ? 1 : 3)];
+			if (l == SIM_LEVEL_NONE)
+				continue;
+			sim.shown[y][x] = l == SIM_LEVEL_WHITE ? SIM_WHITE : SIM_BLACK;
+			driven++;
+		}
+	}
+
+	sim.busy_until_us = sim.now_us + (uint64_t)ms * 1000;
+	sim.total.refreshes++;
+	sim.total.driven += driven;
+	sim.total.refresh_ms += ms;
+	sim.last.refreshes++;
+	sim.last.driven = driven;
+	sim.last.refresh_ms = ms;
+
+	if (sim.verbose)
+	{
+		printf("%8.1f s  refresh %-7s x %3d-%3d y %3d-%3d  %6u bytes %4u lut  %6u driven  %5u ms\n",
+			   sim.now_us / 1e6, kwr ? "kwr" : (reg ? "kw lut" : "kw otp"),
+			   x0 * 8, x1 * 8 + 7, y0, y1, sim.last.data_bytes, sim.last.lut_bytes, driven, ms);
+	}
+	if (sim.dump_dir)
+	{
+		char path[400];
+		snprintf(path, sizeof(path), "%s/frame_%04u", sim.dump_dir, sim.total.refreshes);
+		Sim_Dump(path);
+	}
+	memset(&sim.last, 0, sizeof(sim.last));
+}
+
+/**
+ * @brief Command byte (DC low)
+ */
+void Sim_Panel_Command(uint8_t cmd)
+{
+	sim.cmd = cmd;
+	sim.arg = 0;
+	sim.total.commands++;
+	sim.last.commands++;
+	Sim_Advance_us(SIM_BYTE_US);
+	sim.total.spi_us += SIM_BYTE_US;
+
+	switch (cmd)
+	{
+		case 0x04:  // power on
+			sim.busy_until_us = sim.now_us + (uint64_t)SIM_POWER_ON_MS * 1000;
+			break;
+		case 0x10:
+		case 0x13:
+			sim.x = Sim_Window_X0();
+			sim.y = Sim_Window_Y0();
+			break;
+		case 0x91:
+			sim.partial = 1;
+			break;
+		case 0x92:
+			sim.partial = 0;
+			break;
+		case 0x12:
+			Sim_Refresh();
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * @brief Data byte (DC high), parameter of the last command
+ */
+void Sim_Panel_Data(uint8_t data)
+{
+	uint16_t arg = sim.arg++;
+
+	sim.total.data_bytes++;
+	sim.last.data_bytes++;
+	Sim_Advance_us(SIM_BYTE_US);
+	sim.total.spi_us += SIM_BYTE_US;
+
+	switch (sim.cmd)
+	{
+		case 0x00:
+			if (arg == 0)
+				sim.psr = data;
+			break;
+		case 0x10:
+		case 0x13:
+			if (sim.y > Sim_Window_Y1() || sim.y >= EPAPER_HEIGHT)
+				break;
+			if (sim.cmd == 0x10)
+				sim.old_plane[sim.y][sim.x] = data;
+			else
+				sim.new_plane[sim.y][sim.x] = data;
+			if (++sim.x > Sim_Window_X1())
+			{
+				sim.x = Sim_Window_X0();
+				sim.y++;
+			}
+			break;
+		case 0x17:
+			if (data == 0xA5)
+				Sim_Refresh();
+			break;
+		case 0x20: case 0x21: case 0x22: case 0x23: case 0x24:
+			sim.total.lut_bytes++;
+			sim.last.lut_bytes++;
+			if (arg < EPAPER_LUT_SIZE)
+				sim.lut[sim.cmd - SIM_LUT_FIRST][arg] = data;
+			break;
+		case 0x90:
+			if (arg < sizeof(sim.window))
+				sim.window[arg] = data;
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * @brief Pixel of the virtual panel at screen coordinates
+ */
+Sim_Color Sim_Pixel(uint16_t x, uint16_t y)
+{
+	uint16_t px, py;
+
+	switch (EPAPER_ROTATION)
+	{
+		case EPAPER_ROTATE_90:  px = EPAPER_WIDTH - 1 - y; py = x; break;
+		case EPAPER_ROTATE_180: px = EPAPER_WIDTH - 1 - x; py = EPAPER_HEIGHT - 1 - y; break;
+		case EPAPER_ROTATE_270: px = y; py = EPAPER_HEIGHT - 1 - x; break;
+		default:                px = x; py = y; break;
+	}
+	return (Sim_Color)sim.shown[py][px];
+}
+
+uint64_t Sim_Now_us(void)
+{
+	return sim.now_us;
+}
+
+void Sim_Advance_us(uint64_t us)
+{
+	sim.now_us += us;
+}
+
+uint64_t Sim_Busy_Until_us(void)
+{
+	return sim.busy_until_us;
+}
+
+const Sim_Stats *Sim_Get_Stats(void)
+{
+	return &sim.total;
+}
@@ -0,0 +1,54 @@
+/*
+ * sim_panel.h
+ *
+ *  Model of the e-Paper controller for the host simulator: decodes the
+ *  command stream into the two data planes, applies refreshes to a virtual
+ *  panel with the uploaded waveforms and keeps a virtual clock.
+ */
+
+#ifndef SIM_PANEL_H_
+#define SIM_PANEL_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include "EPAPER.h"
+
+#define SIM_BYTE_US 2           // SPI byte with its CS pulse (TIM2 paced DMA)
+#define SIM_FRAME_MS 20         // waveform frame, 50 Hz
+#define SIM_POWER_ON_MS 80
+#define SIM_RESET_MS 402        // EPAPER_Reset delays
+#define SIM_OTP_KW_MS 2000      // refresh times with the OTP waveforms
+#define SIM_OTP_KWR_MS 15000
+
+// Virtual panel pixels
+typedef enum
+{
+	SIM_WHITE = 0,
+	SIM_BLACK,
+	SIM_RED
+} Sim_Color;
+
+// Transfer counters, since start and since the last refresh
+typedef struct
+{
+	uint32_t commands;
+	uint32_t data_bytes;
+	uint32_t lut_bytes;
+	uint32_t refreshes;
+	uint32_t driven;        // pixels that went through a driving waveform
+	uint64_t spi_us;
+	uint64_t refresh_ms;
+} Sim_Stats;
+
+void Sim_Panel_Init(const char *dump_dir, uint8_t verbose);
+void Sim_Panel_Reset(void);
+void Sim_Panel_Command(uint8_t cmd);
+void Sim_Panel_Data(uint8_t data);
+uint64_t Sim_Now_us(void);
+void Sim_Advance_us(uint64_t us);
+uint64_t Sim_Busy_Until_us(void);
+const Sim_Stats *Sim_Get_Stats(void);
+Sim_Color Sim_Pixel(uint16_t x, uint16_t y);
+int Sim_Dump(const char *path);
+
+#endif /* SIM_PANEL_H_ */
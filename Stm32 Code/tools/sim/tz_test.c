@@ -0,0 +1,132 @@
+/*
+ * tz_test.c
+ *
+ *  Host check of the time zone table of Drivers/DATE against the zoneinfo
+ *  files of the C library (tzdata): for each zone, from the year its
+ *  current rule applies to 2100, a walk in uneven steps, random times
+ *  (which jump back and forth between periods) and the second before and
+ *  the second of each change.
+ *
+ *  make test (or make tz_test && ./tz_test), exits with 1 on a mismatch.
+ *  Add a line here with each new zone of TZ_Zone.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "date_converter.h"
+#include "time_zone.h"
+
+#define TZ_TEST_RANDOM 200000
+
+/* tzdata name of each zone and first year of its current rule */
+static const struct
+{
+	const char *name;
+	uint16_t from;
+} tz_zones[TZ_COUNT] =
+{
+	[TZ_UTC]         = {"UTC", 1970},
+	[TZ_LONDON]      = {"Europe/London", 1996},
+	[TZ_PARIS]       = {"Europe/Paris", 1996},
+	[TZ_HELSINKI]    = {"Europe/Helsinki", 1996},
+	[TZ_MOSCOW]      = {"Europe/Moscow", 2015},
+	[TZ_KOLKATA]     = {"Asia/Kolkata", 1970},
+	[TZ_SHANGHAI]    = {"Asia/Shanghai", 1992},
+	[TZ_TOKYO]       = {"Asia/Tokyo", 1970},
+	[TZ_SYDNEY]      = {"Australia/Sydney", 2009},
+	[TZ_AUCKLAND]    = {"Pacific/Auckland", 2008},
+	[TZ_SAO_PAULO]   = {"America/Sao_Paulo", 2020},
+	[TZ_NEW_YORK]    = {"America/New_York", 2008},
+	[TZ_CHICAGO]     = {"America/Chicago", 2008},
+	[TZ_DENVER]      = {"America/Denver", 2008},
+	[TZ_PHOENIX]     = {"America/Phoenix", 1970},
+	[TZ_LOS_ANGELES] = {"America/Los_Angeles", 2008},
+};
+
+static long bad = 0;
+
+static int32_t Ref_Offset(uint32_t utc)
+{
+	time_t t = utc;
+	struct tm local;
+
+	localtime_r(&t, &local);
+	return local.tm_gmtoff;
+}
+
+static void Check(uint8_t zone, uint32_t utc)
+{
+	int32_t got = (int32_t)(TZ_Local(utc) - utc);
+	int32_t want = Ref_Offset(utc);
+
+	if (got != want)
+	{
+		if (bad < 10)
+			printf("%s %u: offset %d s, want %d s\n", tz_zones[zone].name, utc, got, want);
+		bad++;
+	}
+}
+
+int main(void)
+{
+	const char *dir = getenv("TZDIR") ? getenv("TZDIR") : "/usr/share/zoneinfo";
+	int skipped = 0;
+
+	for (uint8_t zone = 0; zone < TZ_COUNT; zone++)
+	{
+		char path[256];
+		long changes = 0;
+		long before = bad;
+
+		snprintf(path, sizeof(path), "%s/%s", dir, tz_zones[zone].name);
+		if (access(path, R_OK) != 0)
+		{
+			printf("%-20s no zoneinfo file, skipped\n", tz_zones[zone].name);
+			skipped++;
+			continue;
+		}
+		setenv("TZ", tz_zones[zone].name, 1);
+		tzset();
+		TZ_Select(zone);
+
+		uint32_t first = Date_Days(tz_zones[zone].from, 0, 1) * 86400;
+		uint32_t end = Date_Days(2100, 0, 1) * 86400;
+
+		/* walk, the step changes the time of day */
+		for (uint32_t utc = first; utc < end; utc += 1800 + (utc % 7) * 60)
+			Check(zone, utc);
+
+		/* random times */
+		srand(zone + 1);
+		for (long n = 0; n < TZ_TEST_RANDOM; n++)
+			Check(zone, first + (uint32_t)(((uint64_t)rand() * RAND_MAX + rand()) % (end - first)));
+
+		/* each change of the reference, found by bisection inside the hour */
+		for (uint32_t utc = first; utc < end; utc += 3600)
+		{
+			if (Ref_Offset(utc) == Ref_Offset(utc + 3600))
+				continue;
+			uint32_t low = utc;
+			uint32_t high = utc + 3600;
+			while (high - low > 1)
+			{
+				uint32_t mid = low + (high - low) / 2;
+				if (Ref_Offset(mid) == Ref_Offset(low))
+					low = mid;
+				else
+					high = mid;
+			}
+			Check(zone, low);
+			Check(zone, high);
+			changes++;
+		}
+
+		printf("%-20s %u to 2099, %ld changes, %ld mismatch\n", tz_zones[zone].name, tz_zones[zone].from, changes, bad - before);
+	}
+
+	if (skipped)
+		printf("%d zone(s) skipped, install tzdata or set TZDIR\n", skipped);
+	return bad != 0;
+}
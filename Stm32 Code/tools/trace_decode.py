@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""
+trace_decode.py - summarize EPAPER_Trace dumps
+
+Reads the text written by EPAPER_Trace_Dump (a serial log of the board or the
+-r file of tools/sim, other lines are skipped) and tells where the bytes and
+the milliseconds of the panel updates go:
+
+    python3 tools/trace_decode.py uart.log
+    python3 tools/trace_decode.py -u uart.log      also list every update
+
+Costs are given per drawing call (EPAPER_Print_Date, _Hour, ...) as tagged in
+the firmware. A section drawn by several calls (merged dirty regions) and the
+refresh of an update are shared evenly between the calls in it, since the
+panel refreshes all the regions of an update at once. Untagged sections are
+counted under their kind (init, lut, screen).
+
+SPI times come from the millisecond tick, they are only meaningful summed
+over many updates. Only the python standard library is used.
+"""
+
+import sys
+from collections import defaultdict
+
+TAGS = ["other", "date", "hour", "moon", "temp", "press", "hum", "clean", "red"]
+SECTIONS = ["region", "stale", "lut", "refresh", "screen", "init"]
+REFRESH_CMDS = (0x12, 0x17)
+
+
+def owners(kind, tags):
+    names = [TAGS[b] if b < len(TAGS) else "tag%d" % b for b in range(16) if tags & (1 << b)]
+    return names or [SECTIONS[kind] if kind < len(SECTIONS) else "section%d" % kind]
+
+
+class Update:
+    def __init__(self, tick):
+        self.tick = tick
+        self.commands = 0
+        self.bytes = 0
+        self.spi_ms = 0
+        self.busy_ms = 0
+        self.window = None          # refresh window, (width, height)
+        self.refresh_owners = None
+
+
+def read_records(lines):
+    """yield the records of every dump, with a None between dumps"""
+    inside = False
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == "EPAPER_TRACE":
+            inside = True
+            if len(words) > 2 and int(words[2]):
+                sys.stderr.write("warning: %s records were overwritten before a dump\n" % words[2])
+            yield None
+        elif words[0] == "EPAPER_TRACE_END":
+            inside = False
+        elif inside and len(words) == 4 and len(words[0]) == 1:
+            yield words[0], int(words[1], 16), int(words[2], 16), int(words[3])
+
+
+def decode(records):
+    per_owner = defaultdict(lambda: defaultdict(float))
+    per_cmd = defaultdict(lambda: [0, 0, 0])
+    updates = []
+    update = None
+    current = ["init"]
+
+    def charge(names, key, value):
+        for n in names:
+            per_owner[n][key] += value / len(names)
+
+    for rec in records:
+        if rec is None:
+            current = ["init"]
+            continue
+        kind, cmd, arg, value = rec
+        if kind == "U":
+            update = Update(value)
+            updates.append(update)
+            current = ["other"]
+        elif kind == "S":
+            current = owners(cmd, arg)
+            if cmd in (SECTIONS.index("refresh"), SECTIONS.index("screen")) and update is not None:
+                update.refresh_owners = current
+            for n in set(current):
+                per_owner[n]["sections"] += 1
+        elif kind == "C":
+            charge(current, "bytes", 1 + arg)
+            charge(current, "spi_ms", value)
+            stats = per_cmd[cmd]
+            stats[0] += 1
+            stats[1] += arg
+            stats[2] += value
+            if update is not None:
+                update.commands += 1
+                update.bytes += 1 + arg
+                update.spi_ms += value
+        elif kind == "W":
+            if update is not None and update.refresh_owners is current:
+                update.window = (value >> 16, value & 0xFFFF)
+        elif kind == "B":
+            names = current
+            if cmd in REFRESH_CMDS and update is not None and update.refresh_owners:
+                names = update.refresh_owners
+            if cmd not in REFRESH_CMDS:
+                names = ["init"]
+            charge(names, "busy_ms", value)
+            if update is not None:
+                update.busy_ms += value
+    return per_owner, per_cmd, updates
+
+
+def main():
+    args = sys.argv[1:]
+    list_updates = "-u" in args
+    files = [a for a in args if a != "-u"]
+    if not files:
+        files = ["-"]
+
+    lines = []
+    for path in files:
+        f = sys.stdin if path == "-" else open(path, errors="replace")
+        lines += f.readlines()
+
+    per_owner, per_cmd, updates = decode(read_records(lines))
+    if not updates:
+        sys.exit("no EPAPER_TRACE dump found")
+
+    if list_updates:
+        print("%10s %5s %7s %7s %8s  %s" % ("tick", "cmds", "bytes", "spi ms", "busy ms", "window"))
+        for u in updates:
+            window = "%dx%d" % u.window if u.window else "full"
+            print("%10d %5d %7d %7d %8d  %s %s" % (u.tick, u.commands, u.bytes, u.spi_ms, u.busy_ms, window,
+                                                  "+".join(u.refresh_owners or [])))
+        print()
+
+    n = len(updates)
+    print("%d updates, %d bytes, %d ms SPI, %d ms busy" %
+          (n, sum(u.bytes for u in updates), sum(u.spi_ms for u in updates), sum(u.busy_ms for u in updates)))
+    print()
+    print("%-8s %9s %9s %9s %9s %12s" % ("source", "sections", "bytes", "spi ms", "busy ms", "bytes/update"))
+    for name in sorted(per_owner, key=lambda k: -per_owner[k]["bytes"]):
+        o = per_owner[name]
+        print("%-8s %9d %9d %9.1f %9.1f %12.1f" %
+              (name, o["sections"], o["bytes"], o["spi_ms"], o["busy_ms"], o["bytes"] / n))
+    print()
+    print("%-4s %7s %9s %9s" % ("cmd", "count", "data", "spi ms"))
+    for cmd in sorted(per_cmd):
+        count, data, ms = per_cmd[cmd]
+        print("0x%02X %7d %9d %9d" % (cmd, count, data, ms))
+
+
+if __name__ == "__main__":
+    main()